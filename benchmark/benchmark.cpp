@@ -0,0 +1,322 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+// Host benchmark for the core library. Times the hot operations on every save it is given, plus
+// a generated save of each format, and prints the results as JSON:
+//
+//     pksm-benchmark [--min-time <ms>] [save files...]
+
+#include "pkx/FieldLayout.hpp"
+#include "pkx/PKFilter.hpp"
+#include "pkx/PKView.hpp"
+#include "pkx/PKX.hpp"
+#include "sav/Sav.hpp"
+#include "sav/SaveBatch.hpp"
+#include "sav/SaveGenerator.hpp"
+#include "utils/i18n.hpp"
+#include "utils/utils.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Fixture
+    {
+        std::string name;
+        std::shared_ptr<u8[]> data;
+        size_t length;
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::string save;
+        u64 iterations;
+        double nsPerOp;
+    };
+
+    Clock::duration minTime = std::chrono::milliseconds(200);
+    std::vector<Result> results;
+
+    // Repeats op until it has run for at least minTime
+    template <typename Op>
+    void measure(const std::string& name, const std::string& save, Op&& op)
+    {
+        op();
+        u64 iterations          = 0;
+        Clock::time_point start = Clock::now();
+        Clock::duration elapsed;
+        do
+        {
+            op();
+            iterations++;
+            elapsed = Clock::now() - start;
+        } while (elapsed < minTime);
+        results.push_back({name, save, iterations,
+            std::chrono::duration<double, std::nano>(elapsed).count() / iterations});
+    }
+
+    std::shared_ptr<u8[]> copyOf(const Fixture& fixture)
+    {
+        std::shared_ptr<u8[]> ret(new u8[fixture.length]);
+        std::copy(fixture.data.get(), fixture.data.get() + fixture.length, ret.get());
+        return ret;
+    }
+
+    bool loadFixture(const char* path, std::vector<Fixture>& out)
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in)
+        {
+            return false;
+        }
+        size_t length = in.tellg();
+        std::shared_ptr<u8[]> data(new u8[length]);
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(data.get()), length);
+        out.push_back({path, data, length});
+        return bool(in);
+    }
+
+    // A full save of every format, made by the save generator with a fixed seed so that runs are
+    // comparable
+    void addGeneratedFixtures(std::vector<Fixture>& out)
+    {
+        static constexpr const char* formats[] = {"RGBY", "GSC", "RS", "E", "FRLG", "DP", "Pt",
+            "HGSS", "BW", "B2W2", "XY", "ORAS", "SM", "USUM", "LGPE", "SWSH"};
+        for (size_t i = 0; i < std::size(formats); i++)
+        {
+            std::unique_ptr<pksm::Sav> save =
+                pksm::generateSave(pksm::SaveFormat(i), 1, std::numeric_limits<int>::max());
+            out.push_back({std::string("generated-") + formats[i], save->rawData(),
+                save->getLength()});
+        }
+    }
+
+    void benchSave(const Fixture& fixture, const std::vector<std::unique_ptr<pksm::PKX>>& sources)
+    {
+        measure("getSave", fixture.name,
+            [&] { (void)pksm::Sav::getSave(copyOf(fixture), fixture.length); });
+        measure("getSave(ReadOnly)", fixture.name, [&] {
+            (void)pksm::Sav::getSave(copyOf(fixture), fixture.length, pksm::Sav::ReadOnly);
+        });
+
+        std::unique_ptr<pksm::Sav> save = pksm::Sav::getSave(copyOf(fixture), fixture.length);
+        if (!save)
+        {
+            return;
+        }
+
+        measure("pkm scan", fixture.name, [&] {
+            for (int box = 0; box < save->maxBoxes(); box++)
+            {
+                for (int slot = 0; slot < 30; slot++)
+                {
+                    (void)save->pkm(box, slot);
+                }
+            }
+        });
+        measure("forEachBoxSlot(1 thread)", fixture.name,
+            [&] { save->forEachBoxSlot([](u8, u8, const pksm::PKX&) {}, false, 1); });
+        measure("forEachBoxSlot", fixture.name,
+            [&] { save->forEachBoxSlot([](u8, u8, const pksm::PKX&) {}); });
+        measure("cryptBoxData", fixture.name, [&] {
+            save->cryptBoxData(true);
+            save->cryptBoxData(false);
+        });
+        measure("finishEditing", fixture.name, [&] {
+            save->finishEditing();
+            save->beginEditing();
+        });
+        measure("transfer", fixture.name, [&] {
+            for (const auto& pk : sources)
+            {
+                (void)save->transfer(*pk);
+            }
+        });
+
+        pksm::PKFilter filter;
+        filter.species(pksm::Species::Pikachu);
+        filter.speciesEnabled(true);
+        filter.level(50);
+        filter.levelEnabled(true);
+        std::vector<std::unique_ptr<pksm::PKX>> box;
+        for (int slot = 0; slot < 30; slot++)
+        {
+            box.emplace_back(save->pkm(0, slot));
+        }
+        measure("PKFilter", fixture.name, [&] {
+            for (const auto& pk : box)
+            {
+                (void)(*pk == filter);
+            }
+        });
+
+        std::vector<u16> tids(box.size());
+        pksm::visitFormat(*box.front(), [&](const auto& first) {
+            using Pkm = std::remove_cvref_t<decltype(first)>;
+            std::vector<const u8*> records;
+            for (const auto& pk : box)
+            {
+                records.emplace_back(pksm::PKView<Pkm>(static_cast<const Pkm&>(*pk)).record());
+            }
+            measure("extractField", fixture.name,
+                [&] { pksm::extractField(Pkm::Fields::TID, records, std::span{tids}); });
+            return true;
+        });
+    }
+
+    void benchStrings(void)
+    {
+        u8 buffer[0x40] = {};
+        const std::string name = "Pikachu-Test";
+        measure("setString+getString Gen67", "", [&] {
+            StringUtils::setString(buffer, name, 0, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
+            (void)StringUtils::getString(buffer, 0, 13, u'\0', StringUtils::CharSwap::Gen67);
+        });
+        measure("setString4+getString4", "", [&] {
+            StringUtils::setString4(buffer, name, 0, 13);
+            (void)StringUtils::getString4(buffer, 0, 13);
+        });
+        measure("setString3+getString3", "", [&] {
+            StringUtils::setString3(buffer, name, 0, 11, false);
+            (void)StringUtils::getString3(buffer, 0, 11, false);
+        });
+        measure("UTF8toUTF16+UTF16toUTF8", "", [&] {
+            (void)StringUtils::UTF16toUTF8(StringUtils::UTF8toUTF16(name));
+        });
+    }
+
+    // Opens every fixture and counts its occupied box slots, once serially and once on every core
+    void benchBatch(const std::vector<Fixture>& fixtures)
+    {
+        pksm::SaveBatch batch;
+        for (const Fixture& fixture : fixtures)
+        {
+            batch.add(fixture.data, fixture.length);
+        }
+        auto countOccupied = [](const pksm::Sav& save) {
+            size_t count = 0;
+            save.forEachBoxSlot([&](u8, u8, const pksm::PKX&) { count++; }, true, 1);
+            return count;
+        };
+        measure("SaveBatch(1 thread)", "", [&] { (void)batch.run(countOccupied, 1); });
+        measure("SaveBatch", "", [&] { (void)batch.run(countOccupied); });
+    }
+
+    void benchI18n(void)
+    {
+        measure("i18n init", "", [] {
+            i18n::exit();
+            i18n::init(pksm::Language::ENG);
+        });
+        i18n::init(pksm::Language::ENG);
+        measure("i18n species lookups", "", [] {
+            for (u16 species = 1; species <= u16(pksm::Species::Calyrex); species++)
+            {
+                (void)i18n::species(pksm::Language::ENG, pksm::Species{species});
+            }
+        });
+        measure("i18n move lookups", "", [] {
+            for (u16 move = 1; move < u16(pksm::Move::INVALID); move++)
+            {
+                (void)i18n::move(pksm::Language::ENG, pksm::Move{move});
+            }
+        });
+    }
+
+    void printJson(void)
+    {
+        std::printf("{\n  \"benchmarks\": [");
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            std::string save;
+            for (char c : results[i].save)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    save += '\\';
+                }
+                save += c;
+            }
+            std::printf("%s\n    {\"name\": \"%s\", \"save\": \"%s\", \"iterations\": %llu, "
+                        "\"ns_per_op\": %.1f}",
+                i == 0 ? "" : ",", results[i].name.c_str(), save.c_str(),
+                (unsigned long long)results[i].iterations, results[i].nsPerOp);
+        }
+        std::printf("\n  ]\n}\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<Fixture> fixtures;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+        {
+            minTime = std::chrono::milliseconds(std::atoi(argv[++i]));
+        }
+        else if (!loadFixture(argv[i], fixtures))
+        {
+            std::fprintf(stderr, "Could not read %s\n", argv[i]);
+            return 1;
+        }
+    }
+    addGeneratedFixtures(fixtures);
+
+    i18n::init(pksm::Language::ENG);
+
+    // One Pokémon from each save, to be transferred into every other one
+    std::vector<std::unique_ptr<pksm::PKX>> sources;
+    for (const Fixture& fixture : fixtures)
+    {
+        if (auto save = pksm::Sav::getSave(copyOf(fixture), fixture.length))
+        {
+            auto pk = save->emptyPkm();
+            pk->species(pksm::Species::Pikachu);
+            pk->level(50);
+            sources.emplace_back(std::move(pk));
+        }
+    }
+
+    for (const Fixture& fixture : fixtures)
+    {
+        benchSave(fixture, sources);
+    }
+    benchBatch(fixtures);
+    benchStrings();
+    benchI18n();
+
+    printJson();
+}
@@ -0,0 +1,138 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PERSONALTABLE_HPP
+#define PERSONALTABLE_HPP
+
+#include "enums/Generation.hpp"
+#include "personal/personal.hpp"
+
+namespace pksm
+{
+    // Maps a generation to its personal table, so code that knows its generation at compile time
+    // can use it without a switch. Only generations with PersonalEntry data are specialized.
+    template <pksm::Generation::EnumType g>
+    struct PersonalTable
+    {
+    };
+
+    template <>
+    struct PersonalTable<pksm::Generation::THREE>
+    {
+        [[nodiscard]] static const PersonalEntry& entry(u16 formSpecies)
+        {
+            return PersonalRSFRLGE::entry(formSpecies);
+        }
+        [[nodiscard]] static const PersonalColumns& columns(void)
+        {
+            return PersonalRSFRLGE::columns();
+        }
+    };
+
+    template <>
+    struct PersonalTable<pksm::Generation::FOUR>
+    {
+        [[nodiscard]] static const PersonalEntry& entry(u16 formSpecies)
+        {
+            return PersonalDPPtHGSS::entry(formSpecies);
+        }
+        [[nodiscard]] static const PersonalColumns& columns(void)
+        {
+            return PersonalDPPtHGSS::columns();
+        }
+    };
+
+    template <>
+    struct PersonalTable<pksm::Generation::FIVE>
+    {
+        [[nodiscard]] static const PersonalEntry& entry(u16 formSpecies)
+        {
+            return PersonalBWB2W2::entry(formSpecies);
+        }
+        [[nodiscard]] static const PersonalColumns& columns(void)
+        {
+            return PersonalBWB2W2::columns();
+        }
+    };
+
+    template <>
+    struct PersonalTable<pksm::Generation::SIX>
+    {
+        [[nodiscard]] static const PersonalEntry& entry(u16 formSpecies)
+        {
+            return PersonalXYORAS::entry(formSpecies);
+        }
+        [[nodiscard]] static const PersonalColumns& columns(void)
+        {
+            return PersonalXYORAS::columns();
+        }
+    };
+
+    template <>
+    struct PersonalTable<pksm::Generation::SEVEN>
+    {
+        [[nodiscard]] static const PersonalEntry& entry(u16 formSpecies)
+        {
+            return PersonalSMUSUM::entry(formSpecies);
+        }
+        [[nodiscard]] static const PersonalColumns& columns(void)
+        {
+            return PersonalSMUSUM::columns();
+        }
+    };
+
+    template <>
+    struct PersonalTable<pksm::Generation::LGPE>
+    {
+        [[nodiscard]] static const PersonalEntry& entry(u16 formSpecies)
+        {
+            return PersonalLGPE::entry(formSpecies);
+        }
+        [[nodiscard]] static const PersonalColumns& columns(void)
+        {
+            return PersonalLGPE::columns();
+        }
+    };
+
+    template <>
+    struct PersonalTable<pksm::Generation::EIGHT>
+    {
+        [[nodiscard]] static const PersonalEntry& entry(u16 formSpecies)
+        {
+            return PersonalSWSH::entry(formSpecies);
+        }
+        [[nodiscard]] static const PersonalColumns& columns(void)
+        {
+            return PersonalSWSH::columns();
+        }
+    };
+
+    // Runtime equivalents. Return nullptr for generations without PersonalEntry data.
+    [[nodiscard]] const PersonalEntry* personalEntry(Generation gen, u16 formSpecies);
+    [[nodiscard]] const PersonalColumns* personalColumns(Generation gen);
+}
+
+#endif
@@ -30,9 +30,47 @@
 #include "enums/Ability.hpp"
 #include "enums/Type.hpp"
 #include "utils/coretypes.h"
+#include <array>
+#include <span>
 
 namespace pksm
 {
+    // One species' whole row, for callers that need several fields at once. Fields a game doesn't
+    // have are zero (or Ability::None).
+    struct PersonalEntry
+    {
+        u8 baseHP;
+        u8 baseAtk;
+        u8 baseDef;
+        u8 baseSpe;
+        u8 baseSpa;
+        u8 baseSpd;
+        Type type1;
+        Type type2;
+        u8 gender;
+        u8 baseFriendship;
+        u8 expType;
+        std::array<Ability, 3> abilities;
+        u16 formStatIndex;
+        u8 formCount;
+    };
+
+    // The same data split into one array per field and indexed by form species, for scans over the
+    // whole table (e.g. every species with base Speed above 100)
+    struct PersonalColumns
+    {
+        std::span<const u8> baseHP;
+        std::span<const u8> baseAtk;
+        std::span<const u8> baseDef;
+        std::span<const u8> baseSpe;
+        std::span<const u8> baseSpa;
+        std::span<const u8> baseSpd;
+        std::span<const Type> type1;
+        std::span<const Type> type2;
+        std::span<const u8> gender;
+        std::span<const u8> expType;
+    };
+
     namespace PersonalLGPE
     {
         [[nodiscard]] u8 baseHP(u16 formSpecies);
@@ -49,6 +87,8 @@ namespace pksm
         [[nodiscard]] Ability ability(u16 formSpecies, u8 n);
         [[nodiscard]] u16 formStatIndex(u16 formSpecies);
         [[nodiscard]] u8 formCount(u16 formSpecies);
+        [[nodiscard]] const PersonalEntry& entry(u16 formSpecies);
+        [[nodiscard]] const PersonalColumns& columns(void);
     }
 
     namespace PersonalSMUSUM
@@ -67,6 +107,8 @@ namespace pksm
         [[nodiscard]] Ability ability(u16 formSpecies, u8 n);
         [[nodiscard]] u16 formStatIndex(u16 formSpecies);
         [[nodiscard]] u8 formCount(u16 formSpecies);
+        [[nodiscard]] const PersonalEntry& entry(u16 formSpecies);
+        [[nodiscard]] const PersonalColumns& columns(void);
     }
 
     namespace PersonalXYORAS
@@ -85,6 +127,8 @@ namespace pksm
         [[nodiscard]] Ability ability(u16 formSpecies, u8 n);
         [[nodiscard]] u16 formStatIndex(u16 formSpecies);
         [[nodiscard]] u8 formCount(u16 formSpecies);
+        [[nodiscard]] const PersonalEntry& entry(u16 formSpecies);
+        [[nodiscard]] const PersonalColumns& columns(void);
     }
 
     namespace PersonalBWB2W2
@@ -103,6 +147,8 @@ namespace pksm
         [[nodiscard]] Ability ability(u16 formSpecies, u8 n);
         [[nodiscard]] u16 formStatIndex(u16 formSpecies);
         [[nodiscard]] u8 formCount(u16 formSpecies);
+        [[nodiscard]] const PersonalEntry& entry(u16 formSpecies);
+        [[nodiscard]] const PersonalColumns& columns(void);
     }
 
     namespace PersonalDPPtHGSS
@@ -121,6 +167,8 @@ namespace pksm
         [[nodiscard]] Ability ability(u16 formSpecies, u8 n);
         [[nodiscard]] u16 formStatIndex(u16 formSpecies);
         [[nodiscard]] u8 formCount(u16 formSpecies);
+        [[nodiscard]] const PersonalEntry& entry(u16 formSpecies);
+        [[nodiscard]] const PersonalColumns& columns(void);
     }
 
     namespace PersonalSWSH
@@ -143,6 +191,8 @@ namespace pksm
         [[nodiscard]] u16 armordexIndex(u16 species);
         [[nodiscard]] u16 crowndexIndex(u16 species);
         [[nodiscard]] bool canLearnTR(u16 formSpecies, u8 trID);
+        [[nodiscard]] const PersonalEntry& entry(u16 formSpecies);
+        [[nodiscard]] const PersonalColumns& columns(void);
     }
 
     namespace PersonalRSFRLGE
@@ -160,6 +210,8 @@ namespace pksm
         [[nodiscard]] u8 expType(u16 formSpecies);
         [[nodiscard]] Ability ability(u16 formSpecies, u8 n);
         [[nodiscard]] u8 formCount(u16 formSpecies);
+        [[nodiscard]] const PersonalEntry& entry(u16 formSpecies);
+        [[nodiscard]] const PersonalColumns& columns(void);
     }
 
     namespace PersonalGSC
@@ -0,0 +1,177 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef FIELDLAYOUT_HPP
+#define FIELDLAYOUT_HPP
+
+#include "enums/Ribbon.hpp"
+#include "utils/coretypes.h"
+#include "utils/endian.hpp"
+#include <array>
+#include <bit>
+#include <concepts>
+#include <initializer_list>
+#include <span>
+#include <utility>
+
+namespace pksm
+{
+    // One field of a decrypted PKM record: `bytes` bytes at `offset`, of which bits
+    // [shift, shift + bits) hold the value. Each format lists its fields in a nested Fields struct
+    // (e.g. PK7::Fields::Species), and the format's getters and setters go through them
+    template <std::unsigned_integral T>
+    struct PKField
+    {
+        u16 offset;
+        u8 shift           = 0;
+        u8 bits            = sizeof(T) * 8;
+        u8 bytes           = sizeof(T);
+        std::endian endian = std::endian::little;
+
+        [[nodiscard]] constexpr T mask(void) const
+        {
+            return bits >= sizeof(T) * 8 ? T(~T(0)) : T((T(1) << bits) - 1);
+        }
+
+        // Element i of an array of these fields, such as the four moves
+        [[nodiscard]] constexpr PKField at(size_t i) const
+        {
+            PKField ret = *this;
+            ret.offset  = u16(offset + i * bytes);
+            return ret;
+        }
+
+        [[nodiscard]] constexpr T read(const u8* data) const
+        {
+            return T(readWord(data) >> shift) & mask();
+        }
+
+        constexpr void write(u8* data, T v) const
+        {
+            if (shift == 0 && bits >= sizeof(T) * 8)
+            {
+                writeWord(data, v);
+            }
+            else
+            {
+                const T cleared = readWord(data) & ~T(mask() << shift);
+                writeWord(data, T(cleared | ((v & mask()) << shift)));
+            }
+        }
+
+    private:
+        [[nodiscard]] constexpr T readWord(const u8* data) const
+        {
+            if (bytes == sizeof(T))
+            {
+                return endian == std::endian::little ? LittleEndian::convertTo<T>(data + offset)
+                                                     : BigEndian::convertTo<T>(data + offset);
+            }
+            T ret = 0;
+            for (size_t i = 0; i < bytes; i++)
+            {
+                const size_t byte = endian == std::endian::little ? i : bytes - 1 - i;
+                ret |= T(T(data[offset + byte]) << (8 * i));
+            }
+            return ret;
+        }
+
+        constexpr void writeWord(u8* data, T v) const
+        {
+            if (bytes == sizeof(T))
+            {
+                if (endian == std::endian::little)
+                {
+                    LittleEndian::convertFrom<T>(data + offset, v);
+                }
+                else
+                {
+                    BigEndian::convertFrom<T>(data + offset, v);
+                }
+                return;
+            }
+            for (size_t i = 0; i < bytes; i++)
+            {
+                const size_t byte   = endian == std::endian::little ? i : bytes - 1 - i;
+                data[offset + byte] = u8(v >> (8 * i));
+            }
+        }
+    };
+
+    // Where a ribbon's flag lives in a record
+    struct RibbonBit
+    {
+        u16 offset = 0xFFFF;
+        u8 bit     = 0;
+
+        [[nodiscard]] constexpr bool present(void) const { return offset != 0xFFFF; }
+    };
+
+    inline constexpr size_t RIBBON_COUNT = size_t(Ribbon::MarkSlump) + 1;
+
+    // Every ribbon a format doesn't list is absent
+    using RibbonTable = std::array<RibbonBit, RIBBON_COUNT>;
+
+    [[nodiscard]] consteval RibbonTable makeRibbonTable(
+        std::initializer_list<std::pair<Ribbon, RibbonBit>> ribbons)
+    {
+        RibbonTable ret{};
+        for (const auto& [ribbon, bit] : ribbons)
+        {
+            ret[size_t(ribbon)] = bit;
+        }
+        return ret;
+    }
+
+    [[nodiscard]] constexpr RibbonBit ribbonBit(const RibbonTable& table, Ribbon ribbon)
+    {
+        return size_t(ribbon) < table.size() ? table[size_t(ribbon)] : RibbonBit{};
+    }
+
+    // Reads one field out of out.size() decrypted records laid out stride bytes apart, such as a
+    // decrypted bank or an exported box. For PK1 and PK2 the records are the stored structs
+    // without the species list in front of them (see Fields::RecordStart)
+    template <std::unsigned_integral T>
+    void extractField(const PKField<T>& field, const u8* records, size_t stride, std::span<T> out)
+    {
+        for (size_t i = 0; i < out.size(); i++)
+        {
+            out[i] = field.read(records + i * stride);
+        }
+    }
+
+    // The same for records that aren't contiguous, e.g. PKView::record() of a box's worth of PKX
+    template <std::unsigned_integral T>
+    void extractField(const PKField<T>& field, std::span<const u8* const> records, std::span<T> out)
+    {
+        for (size_t i = 0; i < out.size() && i < records.size(); i++)
+        {
+            out[i] = field.read(records[i]);
+        }
+    }
+}
+
+#endif
@@ -28,11 +28,12 @@
 #define PK1_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/FieldLayout.hpp"
 #include "pkx/PKX.hpp"
 
 namespace pksm
 {
-    class PK1 : public PKX
+    class PK1 final : public PKX
     {
     private:
         u8* shiftedData;
@@ -53,6 +54,9 @@ namespace pksm
         [[nodiscard]] int metDay(void) const override { return 1; }
         void metDay(int) override {}
 
+    protected:
+        [[nodiscard]] bool matchesFilter(const PKFilter& filter) const override;
+
     public:
         static constexpr size_t JP_LENGTH_WITH_NAMES  = 59;
         static constexpr size_t INT_LENGTH_WITH_NAMES = 69;
@@ -62,6 +66,19 @@ namespace pksm
 
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Mew;
 
+        // The fields read and written directly, for PKView and extractField. Offsets are from the
+        // start of the stored struct, which follows the one-entry species list in rawData()
+        struct Fields
+        {
+            static constexpr size_t RecordStart = 3;
+
+            static constexpr PKField<u8> SpeciesID1{0};
+            static constexpr PKField<u8> CatchRate{7};
+            static constexpr PKField<u8> Move{8};
+            static constexpr PKField<u16> TID{12, 0, 16, 2, std::endian::big};
+            static constexpr PKField<u32> Experience{14, 0, 24, 3, std::endian::big};
+        };
+
         PK1(PrivateConstructor, u8* dt, bool japanese = false, bool directAccess = false);
 
         [[nodiscard]] std::string_view extension() const override { return ".pk1"; }
@@ -261,6 +278,7 @@ namespace pksm
 
     private:
         [[nodiscard]] u16 statImpl(Stat stat) const override;
+        [[nodiscard]] std::array<u16, 6> statsImpl(void) const override;
     };
 }
 
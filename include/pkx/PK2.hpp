@@ -28,11 +28,12 @@
 #define PK2_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/FieldLayout.hpp"
 #include "pkx/PKX.hpp"
 
 namespace pksm
 {
-    class PK2 : public PKX
+    class PK2 final : public PKX
     {
     private:
         u8* shiftedData;
@@ -54,6 +55,9 @@ namespace pksm
         [[nodiscard]] int metDay(void) const override { return 1; }
         void metDay(int) override {}
 
+    protected:
+        [[nodiscard]] bool matchesFilter(const PKFilter& filter) const override;
+
     public:
         static constexpr size_t JP_LENGTH_WITH_NAMES  = 63;
         static constexpr size_t INT_LENGTH_WITH_NAMES = 73;
@@ -63,6 +67,19 @@ namespace pksm
 
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Celebi;
 
+        // The fields read and written directly, for PKView and extractField. Offsets are from the
+        // start of the stored struct, which follows the one-entry species list in rawData()
+        struct Fields
+        {
+            static constexpr size_t RecordStart = 3;
+
+            static constexpr PKField<u8> Species{0};
+            static constexpr PKField<u8> HeldItem2{1};
+            static constexpr PKField<u8> Move{2};
+            static constexpr PKField<u16> TID{6, 0, 16, 2, std::endian::big};
+            static constexpr PKField<u32> Experience{8, 0, 24, 3, std::endian::big};
+        };
+
         PK2(PrivateConstructor, u8* dt, bool japanese = false, bool directAccess = false);
 
         [[nodiscard]] std::string_view extension() const override { return ".pk2"; }
@@ -257,6 +274,7 @@ namespace pksm
 
     private:
         [[nodiscard]] u16 statImpl(Stat stat) const override;
+        [[nodiscard]] std::array<u16, 6> statsImpl(void) const override;
     };
 }
 
@@ -28,13 +28,16 @@
 #define PK3_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/FieldLayout.hpp"
 #include "pkx/PKX.hpp"
 
 namespace pksm
 {
-    class PK3 : public PKX
+    class PK3 final : public PKX
     {
     protected:
+        [[nodiscard]] bool matchesFilter(const PKFilter& filter) const override;
+
         static constexpr size_t BlockDataLength   = 12;
         static constexpr size_t BlockShuffleStart = 32;
         // Doesn't use pksm::crypto::pkm method because there's no seed stepping
@@ -62,6 +65,23 @@ namespace pksm
         static constexpr size_t PARTY_LENGTH          = 100;
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Deoxys;
 
+        // The fields read and written directly, for PKView and extractField
+        struct Fields
+        {
+            static constexpr size_t RecordStart = 0;
+
+            static constexpr PKField<u32> PID{0x00};
+            static constexpr PKField<u16> TID{0x04};
+            static constexpr PKField<u16> SID{0x06};
+            static constexpr PKField<u8> Language{0x12};
+            static constexpr PKField<u16> SpeciesID3{0x20};
+            static constexpr PKField<u16> HeldItem3{0x22};
+            static constexpr PKField<u32> Experience{0x24};
+            static constexpr PKField<u16> Move{0x2C};
+            static constexpr PKField<u16> MetLevel{0x46, 0, 7};
+            static constexpr PKField<u16> Ball{0x46, 11, 4};
+        };
+
         PK3(PrivateConstructor, u8* dt, bool party = false, bool directAccess = false);
 
         [[nodiscard]] std::string_view extension() const override { return ".pk3"; }
@@ -219,58 +239,29 @@ namespace pksm
         void partyLevel(u8 v) override;
         void updatePartyData(void) override;
 
-        [[nodiscard]] inline u8 baseHP(void) const override
-        {
-            return PersonalRSFRLGE::baseHP(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseAtk(void) const override
-        {
-            return PersonalRSFRLGE::baseAtk(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseDef(void) const override
-        {
-            return PersonalRSFRLGE::baseDef(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpe(void) const override
-        {
-            return PersonalRSFRLGE::baseSpe(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpa(void) const override
-        {
-            return PersonalRSFRLGE::baseSpa(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpd(void) const override
-        {
-            return PersonalRSFRLGE::baseSpd(formSpecies());
-        }
-        [[nodiscard]] inline Type type1(void) const override
-        {
-            return PersonalRSFRLGE::type1(formSpecies());
-        }
-        [[nodiscard]] inline Type type2(void) const override
-        {
-            return PersonalRSFRLGE::type2(formSpecies());
-        }
-        [[nodiscard]] inline u8 genderType(void) const override
-        {
-            return PersonalRSFRLGE::gender(formSpecies());
-        }
+        [[nodiscard]] inline u8 baseHP(void) const override { return personal().baseHP; }
+        [[nodiscard]] inline u8 baseAtk(void) const override { return personal().baseAtk; }
+        [[nodiscard]] inline u8 baseDef(void) const override { return personal().baseDef; }
+        [[nodiscard]] inline u8 baseSpe(void) const override { return personal().baseSpe; }
+        [[nodiscard]] inline u8 baseSpa(void) const override { return personal().baseSpa; }
+        [[nodiscard]] inline u8 baseSpd(void) const override { return personal().baseSpd; }
+        [[nodiscard]] inline Type type1(void) const override { return personal().type1; }
+        [[nodiscard]] inline Type type2(void) const override { return personal().type2; }
+        [[nodiscard]] inline u8 genderType(void) const override { return personal().gender; }
         [[nodiscard]] inline u8 baseFriendship(void) const override
         {
-            return PersonalRSFRLGE::baseFriendship(formSpecies());
-        }
-        [[nodiscard]] inline u8 expType(void) const override
-        {
-            return PersonalRSFRLGE::expType(formSpecies());
+            return personal().baseFriendship;
         }
+        [[nodiscard]] inline u8 expType(void) const override { return personal().expType; }
         [[nodiscard]] inline Ability abilities(u8 n) const override
         {
-            return PersonalRSFRLGE::ability(formSpecies(), n);
+            return personal().abilities[n];
         }
         [[nodiscard]] inline u16 formStatIndex(void) const override { return 0; }
 
     private:
         [[nodiscard]] u16 statImpl(Stat stat) const override;
+        [[nodiscard]] std::array<u16, 6> statsImpl(void) const override;
     };
 }
 
@@ -28,11 +28,12 @@
 #define PK4_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/FieldLayout.hpp"
 #include "pkx/PKX.hpp"
 
 namespace pksm
 {
-    class PK4 : public PKX
+    class PK4 final : public PKX
     {
     private:
         static constexpr size_t BLOCK_LENGTH     = 32;
@@ -51,6 +52,8 @@ namespace pksm
         void metDay(int v) override;
 
     protected:
+        [[nodiscard]] bool matchesFilter(const PKFilter& filter) const override;
+
         static constexpr Species beasts[4] = {
             Species::Celebi, Species::Raikou, Species::Entei, Species::Suicune};
         static constexpr Move banned[8] = {Move::Cut, Move::Fly, Move::Surf, Move::Strength,
@@ -61,6 +64,24 @@ namespace pksm
         static constexpr size_t PARTY_LENGTH          = 236;
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Arceus;
 
+        // The fields read and written directly, for PKView and extractField
+        struct Fields
+        {
+            static constexpr size_t RecordStart = 0;
+
+            static constexpr PKField<u32> PID{0x00};
+            static constexpr PKField<u16> Species{0x08};
+            static constexpr PKField<u16> HeldItem{0x0A};
+            static constexpr PKField<u16> TID{0x0C};
+            static constexpr PKField<u16> SID{0x0E};
+            static constexpr PKField<u32> Experience{0x10};
+            static constexpr PKField<u8> Ability{0x15};
+            static constexpr PKField<u8> Language{0x17};
+            static constexpr PKField<u16> Move{0x28};
+            static constexpr PKField<u8> AlternativeForm{0x40, 3, 5};
+            static constexpr PKField<u8> MetLevel{0x84, 0, 7};
+        };
+
         PK4(PrivateConstructor, u8* dt, bool party = false, bool directAccess = false);
 
         [[nodiscard]] std::string_view extension() const override { return ".pk4"; }
@@ -200,61 +221,32 @@ namespace pksm
         void partyLevel(u8 v) override;
         void updatePartyData(void) override;
 
-        [[nodiscard]] inline u8 baseHP(void) const override
-        {
-            return PersonalDPPtHGSS::baseHP(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseAtk(void) const override
-        {
-            return PersonalDPPtHGSS::baseAtk(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseDef(void) const override
-        {
-            return PersonalDPPtHGSS::baseDef(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpe(void) const override
-        {
-            return PersonalDPPtHGSS::baseSpe(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpa(void) const override
-        {
-            return PersonalDPPtHGSS::baseSpa(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpd(void) const override
-        {
-            return PersonalDPPtHGSS::baseSpd(formSpecies());
-        }
-        [[nodiscard]] inline Type type1(void) const override
-        {
-            return PersonalDPPtHGSS::type1(formSpecies());
-        }
-        [[nodiscard]] inline Type type2(void) const override
-        {
-            return PersonalDPPtHGSS::type2(formSpecies());
-        }
-        [[nodiscard]] inline u8 genderType(void) const override
-        {
-            return PersonalDPPtHGSS::gender(formSpecies());
-        }
+        [[nodiscard]] inline u8 baseHP(void) const override { return personal().baseHP; }
+        [[nodiscard]] inline u8 baseAtk(void) const override { return personal().baseAtk; }
+        [[nodiscard]] inline u8 baseDef(void) const override { return personal().baseDef; }
+        [[nodiscard]] inline u8 baseSpe(void) const override { return personal().baseSpe; }
+        [[nodiscard]] inline u8 baseSpa(void) const override { return personal().baseSpa; }
+        [[nodiscard]] inline u8 baseSpd(void) const override { return personal().baseSpd; }
+        [[nodiscard]] inline Type type1(void) const override { return personal().type1; }
+        [[nodiscard]] inline Type type2(void) const override { return personal().type2; }
+        [[nodiscard]] inline u8 genderType(void) const override { return personal().gender; }
         [[nodiscard]] inline u8 baseFriendship(void) const override
         {
-            return PersonalDPPtHGSS::baseFriendship(formSpecies());
-        }
-        [[nodiscard]] inline u8 expType(void) const override
-        {
-            return PersonalDPPtHGSS::expType(formSpecies());
+            return personal().baseFriendship;
         }
+        [[nodiscard]] inline u8 expType(void) const override { return personal().expType; }
         [[nodiscard]] inline Ability abilities(u8 n) const override
         {
-            return PersonalDPPtHGSS::ability(formSpecies(), n);
+            return personal().abilities[n];
         }
         [[nodiscard]] inline u16 formStatIndex(void) const override
         {
-            return PersonalDPPtHGSS::formStatIndex(formSpecies());
+            return personal().formStatIndex;
         }
 
     private:
         [[nodiscard]] u16 statImpl(Stat stat) const override;
+        [[nodiscard]] std::array<u16, 6> statsImpl(void) const override;
     };
 }
 
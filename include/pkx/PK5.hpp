@@ -28,11 +28,12 @@
 #define PK5_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/FieldLayout.hpp"
 #include "pkx/PKX.hpp"
 
 namespace pksm
 {
-    class PK5 : public PKX
+    class PK5 final : public PKX
     {
     private:
         static constexpr size_t BLOCK_LENGTH     = 32;
@@ -50,11 +51,34 @@ namespace pksm
         [[nodiscard]] int metDay(void) const override;
         void metDay(int v) override;
 
+    protected:
+        [[nodiscard]] bool matchesFilter(const PKFilter& filter) const override;
+
     public:
         static constexpr size_t BOX_LENGTH            = 136;
         static constexpr size_t PARTY_LENGTH          = 220;
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Genesect;
 
+        // The fields read and written directly, for PKView and extractField
+        struct Fields
+        {
+            static constexpr size_t RecordStart = 0;
+
+            static constexpr PKField<u32> PID{0x00};
+            static constexpr PKField<u16> Species{0x08};
+            static constexpr PKField<u16> HeldItem{0x0A};
+            static constexpr PKField<u16> TID{0x0C};
+            static constexpr PKField<u16> SID{0x0E};
+            static constexpr PKField<u32> Experience{0x10};
+            static constexpr PKField<u8> Ability{0x15};
+            static constexpr PKField<u8> Language{0x17};
+            static constexpr PKField<u16> Move{0x28};
+            static constexpr PKField<u8> AlternativeForm{0x40, 3, 5};
+            static constexpr PKField<u8> Nature{0x41};
+            static constexpr PKField<u8> Ball{0x83};
+            static constexpr PKField<u8> MetLevel{0x84, 0, 7};
+        };
+
         PK5(PrivateConstructor, u8* dt, bool party = false, bool directAccess = false);
 
         [[nodiscard]] std::string_view extension() const override { return ".pk5"; }
@@ -193,61 +217,32 @@ namespace pksm
         void partyLevel(u8 v) override;
         void updatePartyData(void) override;
 
-        [[nodiscard]] inline u8 baseHP(void) const override
-        {
-            return PersonalBWB2W2::baseHP(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseAtk(void) const override
-        {
-            return PersonalBWB2W2::baseAtk(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseDef(void) const override
-        {
-            return PersonalBWB2W2::baseDef(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpe(void) const override
-        {
-            return PersonalBWB2W2::baseSpe(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpa(void) const override
-        {
-            return PersonalBWB2W2::baseSpa(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpd(void) const override
-        {
-            return PersonalBWB2W2::baseSpd(formSpecies());
-        }
-        [[nodiscard]] inline Type type1(void) const override
-        {
-            return PersonalBWB2W2::type1(formSpecies());
-        }
-        [[nodiscard]] inline Type type2(void) const override
-        {
-            return PersonalBWB2W2::type2(formSpecies());
-        }
-        [[nodiscard]] inline u8 genderType(void) const override
-        {
-            return PersonalBWB2W2::gender(formSpecies());
-        }
+        [[nodiscard]] inline u8 baseHP(void) const override { return personal().baseHP; }
+        [[nodiscard]] inline u8 baseAtk(void) const override { return personal().baseAtk; }
+        [[nodiscard]] inline u8 baseDef(void) const override { return personal().baseDef; }
+        [[nodiscard]] inline u8 baseSpe(void) const override { return personal().baseSpe; }
+        [[nodiscard]] inline u8 baseSpa(void) const override { return personal().baseSpa; }
+        [[nodiscard]] inline u8 baseSpd(void) const override { return personal().baseSpd; }
+        [[nodiscard]] inline Type type1(void) const override { return personal().type1; }
+        [[nodiscard]] inline Type type2(void) const override { return personal().type2; }
+        [[nodiscard]] inline u8 genderType(void) const override { return personal().gender; }
         [[nodiscard]] inline u8 baseFriendship(void) const override
         {
-            return PersonalBWB2W2::baseFriendship(formSpecies());
-        }
-        [[nodiscard]] inline u8 expType(void) const override
-        {
-            return PersonalBWB2W2::expType(formSpecies());
+            return personal().baseFriendship;
         }
+        [[nodiscard]] inline u8 expType(void) const override { return personal().expType; }
         [[nodiscard]] inline Ability abilities(u8 n) const override
         {
-            return PersonalBWB2W2::ability(formSpecies(), n);
+            return personal().abilities[n];
         }
         [[nodiscard]] inline u16 formStatIndex(void) const override
         {
-            return PersonalBWB2W2::formStatIndex(formSpecies());
+            return personal().formStatIndex;
         }
 
     private:
         [[nodiscard]] u16 statImpl(Stat stat) const override;
+        [[nodiscard]] std::array<u16, 6> statsImpl(void) const override;
     };
 }
 
@@ -28,11 +28,12 @@
 #define PK6_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/FieldLayout.hpp"
 #include "pkx/PKX.hpp"
 
 namespace pksm
 {
-    class PK6 : public PKX
+    class PK6 final : public PKX
     {
     private:
         static constexpr size_t BLOCK_LENGTH     = 56;
@@ -50,11 +51,36 @@ namespace pksm
         [[nodiscard]] int metDay(void) const override;
         void metDay(int v) override;
 
+    protected:
+        [[nodiscard]] bool matchesFilter(const PKFilter& filter) const override;
+
     public:
         static constexpr size_t BOX_LENGTH            = 232;
         static constexpr size_t PARTY_LENGTH          = 260;
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Volcanion;
 
+        // The fields read and written directly, for PKView and extractField
+        struct Fields
+        {
+            static constexpr size_t RecordStart = 0;
+
+            static constexpr PKField<u32> EncryptionConstant{0x00};
+            static constexpr PKField<u16> Species{0x08};
+            static constexpr PKField<u16> HeldItem{0x0A};
+            static constexpr PKField<u16> TID{0x0C};
+            static constexpr PKField<u16> SID{0x0E};
+            static constexpr PKField<u32> Experience{0x10};
+            static constexpr PKField<u8> Ability{0x14};
+            static constexpr PKField<u32> PID{0x18};
+            static constexpr PKField<u8> Nature{0x1C};
+            static constexpr PKField<u8> AlternativeForm{0x1D, 3, 5};
+            static constexpr PKField<u16> Move{0x5A};
+            static constexpr PKField<u16> RelearnMove{0x6A};
+            static constexpr PKField<u8> Ball{0xDC};
+            static constexpr PKField<u8> MetLevel{0xDD, 0, 7};
+            static constexpr PKField<u8> Language{0xE3};
+        };
+
         PK6(PrivateConstructor, u8* dt, bool party = false, bool directAccess = false);
 
         [[nodiscard]] std::string_view extension() const override { return ".pk6"; }
@@ -251,61 +277,32 @@ namespace pksm
         void partyLevel(u8 v) override;
         void updatePartyData(void) override;
 
-        [[nodiscard]] inline u8 baseHP(void) const override
-        {
-            return PersonalXYORAS::baseHP(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseAtk(void) const override
-        {
-            return PersonalXYORAS::baseAtk(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseDef(void) const override
-        {
-            return PersonalXYORAS::baseDef(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpe(void) const override
-        {
-            return PersonalXYORAS::baseSpe(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpa(void) const override
-        {
-            return PersonalXYORAS::baseSpa(formSpecies());
-        }
-        [[nodiscard]] inline u8 baseSpd(void) const override
-        {
-            return PersonalXYORAS::baseSpd(formSpecies());
-        }
-        [[nodiscard]] inline Type type1(void) const override
-        {
-            return PersonalXYORAS::type1(formSpecies());
-        }
-        [[nodiscard]] inline Type type2(void) const override
-        {
-            return PersonalXYORAS::type2(formSpecies());
-        }
-        [[nodiscard]] inline u8 genderType(void) const override
-        {
-            return PersonalXYORAS::gender(formSpecies());
-        }
+        [[nodiscard]] inline u8 baseHP(void) const override { return personal().baseHP; }
+        [[nodiscard]] inline u8 baseAtk(void) const override { return personal().baseAtk; }
+        [[nodiscard]] inline u8 baseDef(void) const override { return personal().baseDef; }
+        [[nodiscard]] inline u8 baseSpe(void) const override { return personal().baseSpe; }
+        [[nodiscard]] inline u8 baseSpa(void) const override { return personal().baseSpa; }
+        [[nodiscard]] inline u8 baseSpd(void) const override { return personal().baseSpd; }
+        [[nodiscard]] inline Type type1(void) const override { return personal().type1; }
+        [[nodiscard]] inline Type type2(void) const override { return personal().type2; }
+        [[nodiscard]] inline u8 genderType(void) const override { return personal().gender; }
         [[nodiscard]] inline u8 baseFriendship(void) const override
         {
-            return PersonalXYORAS::baseFriendship(formSpecies());
-        }
-        [[nodiscard]] inline u8 expType(void) const override
-        {
-            return PersonalXYORAS::expType(formSpecies());
+            return personal().baseFriendship;
         }
+        [[nodiscard]] inline u8 expType(void) const override { return personal().expType; }
         [[nodiscard]] inline Ability abilities(u8 n) const override
         {
-            return PersonalXYORAS::ability(formSpecies(), n);
+            return personal().abilities[n];
         }
         [[nodiscard]] inline u16 formStatIndex(void) const override
         {
-            return PersonalXYORAS::formStatIndex(formSpecies());
+            return personal().formStatIndex;
         }
 
     private:
         [[nodiscard]] u16 statImpl(Stat stat) const override;
+        [[nodiscard]] std::array<u16, 6> statsImpl(void) const override;
     };
 }
 
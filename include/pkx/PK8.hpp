@@ -28,11 +28,12 @@
 #define PK8_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/FieldLayout.hpp"
 #include "pkx/PKX.hpp"
 
 namespace pksm
 {
-    class PK8 : public PKX
+    class PK8 final : public PKX
     {
     private:
         static constexpr size_t BLOCK_LENGTH     = 80;
@@ -51,6 +52,8 @@ namespace pksm
         void metDay(int v) override;
 
     protected:
+        [[nodiscard]] bool matchesFilter(const PKFilter& filter) const override;
+
         static constexpr u16 hyperTrainLookup[6] = {0, 1, 2, 5, 3, 4};
 
     public:
@@ -58,6 +61,28 @@ namespace pksm
         static constexpr size_t PARTY_LENGTH          = 0x158;
         static constexpr Species FORMAT_SPECIES_LIMIT = Species::Zarude;
 
+        // The fields read and written directly, for PKView and extractField
+        struct Fields
+        {
+            static constexpr size_t RecordStart = 0;
+
+            static constexpr PKField<u32> EncryptionConstant{0x00};
+            static constexpr PKField<u16> Species{0x08};
+            static constexpr PKField<u16> HeldItem{0x0A};
+            static constexpr PKField<u16> TID{0x0C};
+            static constexpr PKField<u16> SID{0x0E};
+            static constexpr PKField<u32> Experience{0x10};
+            static constexpr PKField<u16> Ability{0x14};
+            static constexpr PKField<u32> PID{0x1C};
+            static constexpr PKField<u8> Nature{0x21};
+            static constexpr PKField<u16> AlternativeForm{0x24};
+            static constexpr PKField<u16> Move{0x72};
+            static constexpr PKField<u16> RelearnMove{0x82};
+            static constexpr PKField<u8> Language{0xE2};
+            static constexpr PKField<u8> Ball{0x124};
+            static constexpr PKField<u8> MetLevel{0x125, 0, 7};
+        };
+
         PK8(PrivateConstructor, u8* dt, bool party = false, bool directAccess = false);
 
         [[nodiscard]] std::string_view extension() const override { return ".pk8"; }
@@ -260,28 +285,19 @@ namespace pksm
         void shiny(bool v) override;
         u16 formSpecies(void) const override;
 
-        inline u8 baseHP(void) const override { return PersonalSWSH::baseHP(formSpecies()); }
-        inline u8 baseAtk(void) const override { return PersonalSWSH::baseAtk(formSpecies()); }
-        inline u8 baseDef(void) const override { return PersonalSWSH::baseDef(formSpecies()); }
-        inline u8 baseSpe(void) const override { return PersonalSWSH::baseSpe(formSpecies()); }
-        inline u8 baseSpa(void) const override { return PersonalSWSH::baseSpa(formSpecies()); }
-        inline u8 baseSpd(void) const override { return PersonalSWSH::baseSpd(formSpecies()); }
-        inline Type type1(void) const override { return PersonalSWSH::type1(formSpecies()); }
-        inline Type type2(void) const override { return PersonalSWSH::type2(formSpecies()); }
-        inline u8 genderType(void) const override { return PersonalSWSH::gender(formSpecies()); }
-        inline u8 baseFriendship(void) const override
-        {
-            return PersonalSWSH::baseFriendship(formSpecies());
-        }
-        inline u8 expType(void) const override { return PersonalSWSH::expType(formSpecies()); }
-        inline Ability abilities(u8 n) const override
-        {
-            return PersonalSWSH::ability(formSpecies(), n);
-        }
-        inline u16 formStatIndex(void) const override
-        {
-            return PersonalSWSH::formStatIndex(formSpecies());
-        }
+        inline u8 baseHP(void) const override { return personal().baseHP; }
+        inline u8 baseAtk(void) const override { return personal().baseAtk; }
+        inline u8 baseDef(void) const override { return personal().baseDef; }
+        inline u8 baseSpe(void) const override { return personal().baseSpe; }
+        inline u8 baseSpa(void) const override { return personal().baseSpa; }
+        inline u8 baseSpd(void) const override { return personal().baseSpd; }
+        inline Type type1(void) const override { return personal().type1; }
+        inline Type type2(void) const override { return personal().type2; }
+        inline u8 genderType(void) const override { return personal().gender; }
+        inline u8 baseFriendship(void) const override { return personal().baseFriendship; }
+        inline u8 expType(void) const override { return personal().expType; }
+        inline Ability abilities(u8 n) const override { return personal().abilities[n]; }
+        inline u16 formStatIndex(void) const override { return personal().formStatIndex; }
         inline u16 pokedexIndex(void) const { return PersonalSWSH::pokedexIndex(formSpecies()); }
         inline u16 armordexIndex(void) const { return PersonalSWSH::armordexIndex(formSpecies()); }
         inline u16 crowndexIndex(void) const { return PersonalSWSH::crowndexIndex(formSpecies()); }
@@ -292,6 +308,7 @@ namespace pksm
 
     private:
         u16 statImpl(Stat stat) const override;
+        std::array<u16, 6> statsImpl(void) const override;
     };
 }
 
@@ -0,0 +1,198 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKVIEW_HPP
+#define PKVIEW_HPP
+
+#include "pkx/PB7.hpp"
+#include "pkx/PK1.hpp"
+#include "pkx/PK2.hpp"
+#include "pkx/PK3.hpp"
+#include "pkx/PK4.hpp"
+#include "pkx/PK5.hpp"
+#include "pkx/PK6.hpp"
+#include "pkx/PK7.hpp"
+#include "pkx/PK8.hpp"
+#include "pkx/PKFilter.hpp"
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace pksm
+{
+    // Generic PKM algorithms written once and instantiated per format. Every format class is final,
+    // so calls made through a PKView are bound at compile time instead of going through the vtable,
+    // and where a view is instantiated next to the format's getters (in its own translation unit)
+    // they are inlined down to reads at fixed offsets. PKX's virtual interface forwards to these
+    // instantiations.
+    template <typename Pkm>
+        requires std::derived_from<Pkm, PKX> && std::is_final_v<Pkm>
+    class PKView
+    {
+    public:
+        explicit PKView(const Pkm& pk) : pk(pk) {}
+
+        [[nodiscard]] const Pkm& pkm(void) const { return pk; }
+
+        // The start of the record that Pkm::Fields offsets count from, for extractField
+        [[nodiscard]] const u8* record(void) const
+        {
+            return pk.rawData().data() + Pkm::Fields::RecordStart;
+        }
+
+        // What PKX::operator==(const PKFilter&) returns
+        [[nodiscard]] bool matches(const PKFilter& filter) const
+        {
+            if (filter.generationEnabled() &&
+                (filter.generationInversed() != (pk.generation() != filter.generation())))
+            {
+                return false;
+            }
+            if (filter.speciesEnabled() &&
+                (filter.speciesInversed() != (pk.species() != filter.species())))
+            {
+                return false;
+            }
+            if (filter.heldItemEnabled() &&
+                (filter.heldItemInversed() != (pk.heldItem() != filter.heldItem())))
+            {
+                return false;
+            }
+            if (filter.levelEnabled() &&
+                (filter.levelInversed() != (pk.level() != filter.level())))
+            {
+                return false;
+            }
+            if (filter.abilityEnabled() &&
+                (filter.abilityInversed() != (pk.ability() != filter.ability())))
+            {
+                return false;
+            }
+            if (filter.TSVEnabled() && (filter.TSVInversed() != (pk.TSV() != filter.TSV())))
+            {
+                return false;
+            }
+            if (filter.natureEnabled() &&
+                (filter.natureInversed() != (pk.nature() != filter.nature())))
+            {
+                return false;
+            }
+            if (filter.genderEnabled() &&
+                (filter.genderInversed() != (pk.gender() != filter.gender())))
+            {
+                return false;
+            }
+            if (filter.ballEnabled() && (filter.ballInversed() != (pk.ball() != filter.ball())))
+            {
+                return false;
+            }
+            if (filter.languageEnabled() &&
+                (filter.languageInversed() != (pk.language() != filter.language())))
+            {
+                return false;
+            }
+            if (filter.eggEnabled() && (filter.eggInversed() != (pk.egg() != filter.egg())))
+            {
+                return false;
+            }
+            for (int i = 0; i < 4; i++)
+            {
+                if (filter.moveEnabled(i) &&
+                    (filter.moveInversed(i) != (pk.move(i) != filter.move(i))))
+                {
+                    return false;
+                }
+                if (filter.relearnMoveEnabled(i))
+                {
+                    if (pk.generation() < Generation::SIX)
+                    {
+                        return false;
+                    }
+                    else if (filter.relearnMoveInversed(i) !=
+                             (filter.relearnMove(i) != pk.relearnMove(i)))
+                    {
+                        return false;
+                    }
+                }
+            }
+            for (int i = 0; i < 6; i++)
+            {
+                if (filter.ivEnabled(Stat(i)) &&
+                    (filter.ivInversed(Stat(i)) != (pk.iv(Stat(i)) < filter.iv(Stat(i)))))
+                {
+                    return false;
+                }
+            }
+            if (filter.shinyEnabled() && (filter.shinyInversed() != (filter.shiny() != pk.shiny())))
+            {
+                return false;
+            }
+            if (filter.alternativeFormEnabled() &&
+                (filter.alternativeFormInversed() !=
+                    (filter.alternativeForm() != pk.alternativeForm())))
+            {
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        const Pkm& pk;
+    };
+
+    // Calls f with pk downcast to its format class, so that f can be a generic lambda that is
+    // instantiated once per format. Returns a value-initialized result for Generation::UNUSED.
+    template <typename F>
+    auto visitFormat(const PKX& pk, F&& f)
+    {
+        switch (pk.generation())
+        {
+            case Generation::ONE:
+                return std::forward<F>(f)(static_cast<const PK1&>(pk));
+            case Generation::TWO:
+                return std::forward<F>(f)(static_cast<const PK2&>(pk));
+            case Generation::THREE:
+                return std::forward<F>(f)(static_cast<const PK3&>(pk));
+            case Generation::FOUR:
+                return std::forward<F>(f)(static_cast<const PK4&>(pk));
+            case Generation::FIVE:
+                return std::forward<F>(f)(static_cast<const PK5&>(pk));
+            case Generation::SIX:
+                return std::forward<F>(f)(static_cast<const PK6&>(pk));
+            case Generation::SEVEN:
+                return std::forward<F>(f)(static_cast<const PK7&>(pk));
+            case Generation::LGPE:
+                return std::forward<F>(f)(static_cast<const PB7&>(pk));
+            case Generation::EIGHT:
+                return std::forward<F>(f)(static_cast<const PK8&>(pk));
+            case Generation::UNUSED:
+                break;
+        }
+        return std::invoke_result_t<F, const PK8&>{};
+    }
+}
+
+#endif
@@ -45,10 +45,16 @@
 #include "utils/DateTime.hpp"
 #include "utils/coretypes.h"
 #include "utils/genToPkx.hpp"
+#include <array>
+#include <atomic>
 #include <concepts>
 #include <memory>
 #include <string>
 
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
 namespace pksm
 {
     class Sav;
@@ -61,6 +67,7 @@ namespace pksm
     class PK7;
     class PK8;
     class PB7;
+    struct PersonalEntry;
 
     class PKX : public IPKFilterable
     {
@@ -87,7 +94,21 @@ namespace pksm
         PKX(u8* data, size_t length, bool directAccess = false);
 
         [[nodiscard]] u32 expTable(u8 row, u8 col) const;
+        // Experience thresholds for levels 1-100 of a growth rate
+        [[nodiscard]] static const std::array<u32, 100>& expCurve(u8 expType);
+        [[nodiscard]] static u8 levelFromExp(u32 experience, u8 expType);
+        // Generation 3+ stat formula. iv should already account for Hyper Training.
+        [[nodiscard]] static u16 calcStat(
+            Stat stat, u8 baseStat, u8 iv, u16 ev, u8 level, Nature nature);
+        // Generation 1 and 2 stat formula, with ev being stat experience
+        [[nodiscard]] static u16 calcStatGB(Stat stat, u8 baseStat, u8 iv, u16 ev, u8 level);
         virtual void reorderMoves(void);
+        // Personal row for formSpecies(), looked up on first use. Only valid for Generation 3+.
+        [[nodiscard]] const PersonalEntry& personal(void) const;
+        // Must be called whenever the bytes formSpecies() depends on change
+        void invalidatePersonal(void) { personalCache = nullptr; }
+        // Each format forwards this to PKView<Format>::matches
+        [[nodiscard]] virtual bool matchesFilter(const PKFilter& filter) const = 0;
 
         u32 length = 0;
         u8* data;
@@ -149,9 +170,18 @@ namespace pksm
 
         [[nodiscard]] virtual std::string_view extension(void) const = 0;
 
-        [[nodiscard]] std::span<u8> rawData(void) { return {data, length}; }
+        // Writes through the returned span may change species or form, so the cached personal
+        // row is dropped
+        [[nodiscard]] std::span<u8> rawData(void)
+        {
+            invalidatePersonal();
+            return {data, length};
+        }
         [[nodiscard]] std::span<const u8> rawData(void) const { return {data, length}; }
         [[nodiscard]] u32 getLength(void) const { return length; }
+        // Replaces this Pokemon with the one in raw, which must be getLength() bytes long and may
+        // still be encrypted. The existing buffer is reused.
+        void load(std::span<const u8> raw);
         [[nodiscard]] virtual bool isParty(void) const = 0;
 
         virtual void decrypt(void)                     = 0;
@@ -329,6 +359,17 @@ namespace pksm
             }
             return statImpl(stat);
         }
+        // All six stats, indexed by Stat. Cheaper than six calls to stat(), as the species, base
+        // stats, level and nature are only looked up once.
+        [[nodiscard]] std::array<u16, 6> stats(void) const
+        {
+            std::array<u16, 6> ret = statsImpl();
+            if (species() == Species::Shedinja)
+            {
+                ret[size_t(Stat::HP)] = 1;
+            }
+            return ret;
+        }
 
         // Hehehehe... to be done
         // virtual u8 sleepTurns(void) const = 0;
@@ -371,7 +412,15 @@ namespace pksm
         [[nodiscard]] bool isFilter() const final { return false; }
 
     private:
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        mutable const PersonalEntry* personalCache = nullptr;
+#else
+        // Filled in by const personal(), which may run on several threads at once
+        mutable std::atomic<const PersonalEntry*> personalCache = nullptr;
+#endif
+
         [[nodiscard]] virtual u16 statImpl(Stat stat) const = 0;
+        [[nodiscard]] virtual std::array<u16, 6> statsImpl(void) const = 0;
     };
 }
 
@@ -44,6 +44,16 @@ namespace pksm
     class Item7b;
     class Item8;
 
+    // Plain copy of a bag slot. flags holds the slot's bits above its ID and count, shifted down:
+    // Gen 7's free space index, new flag and reserved bit, or LGPE and Gen 8's new flag and
+    // reserved bit
+    struct ItemEntry
+    {
+        u16 id    = 0;
+        u16 count = 0;
+        u16 flags = 0;
+    };
+
     class Item
     {
     public:
@@ -148,6 +158,11 @@ namespace pksm
                 key      = securityKey;
             }
         }
+        Item3(const ItemEntry& entry, u16 securityKey) : itemData{}, key(securityKey)
+        {
+            id(entry.id);
+            count(entry.count);
+        }
         [[nodiscard]] Generation generation(void) const override { return Generation::THREE; }
         [[nodiscard]] u16 maxCount(void) const override { return 0xFFFF; }
         [[nodiscard]] u16 id(void) const override
@@ -174,6 +189,13 @@ namespace pksm
                 data.data() + 2, LittleEndian::convertTo<u16>(data.data() + 2) ^ key);
             return data;
         }
+        [[nodiscard]] ItemEntry entry(void) const { return {id(), count(), 0}; }
+        // Same as bytes(), straight into a save
+        void write(u8* slot) const
+        {
+            std::copy(itemData.begin(), itemData.end(), slot);
+            LittleEndian::convertFrom<u16>(slot + 2, count() ^ key);
+        }
     };
 
     class Item4 : public Item
@@ -193,6 +215,11 @@ namespace pksm
                 itemData = {0, 0, 0, 0};
             }
         }
+        explicit Item4(const ItemEntry& entry) : itemData{}
+        {
+            id(entry.id);
+            count(entry.count);
+        }
         [[nodiscard]] Generation generation(void) const override { return Generation::FOUR; }
         [[nodiscard]] u16 maxCount(void) const override { return 0xFFFF; }
         [[nodiscard]] u16 id(void) const override
@@ -209,6 +236,8 @@ namespace pksm
         {
             return std::vector<u8>{itemData.begin(), itemData.end()};
         }
+        [[nodiscard]] ItemEntry entry(void) const { return {id(), count(), 0}; }
+        void write(u8* slot) const { std::copy(itemData.begin(), itemData.end(), slot); }
     };
 
     class Item5 : public Item
@@ -228,6 +257,11 @@ namespace pksm
                 itemData = {0, 0, 0, 0};
             }
         }
+        explicit Item5(const ItemEntry& entry) : itemData{}
+        {
+            id(entry.id);
+            count(entry.count);
+        }
         [[nodiscard]] Generation generation(void) const override { return Generation::FIVE; }
         [[nodiscard]] u16 maxCount(void) const override { return 0xFFFF; }
         [[nodiscard]] u16 id(void) const override
@@ -244,6 +278,8 @@ namespace pksm
         {
             return std::vector<u8>{itemData.begin(), itemData.end()};
         }
+        [[nodiscard]] ItemEntry entry(void) const { return {id(), count(), 0}; }
+        void write(u8* slot) const { std::copy(itemData.begin(), itemData.end(), slot); }
     };
 
     class Item6 : public Item
@@ -263,6 +299,11 @@ namespace pksm
                 itemData = {0, 0, 0, 0};
             }
         }
+        explicit Item6(const ItemEntry& entry) : itemData{}
+        {
+            id(entry.id);
+            count(entry.count);
+        }
         [[nodiscard]] Generation generation(void) const override { return Generation::SIX; }
         [[nodiscard]] u16 maxCount(void) const override { return 0xFFFF; }
         [[nodiscard]] u16 id(void) const override
@@ -279,6 +320,8 @@ namespace pksm
         {
             return std::vector<u8>{itemData.begin(), itemData.end()};
         }
+        [[nodiscard]] ItemEntry entry(void) const { return {id(), count(), 0}; }
+        void write(u8* slot) const { std::copy(itemData.begin(), itemData.end(), slot); }
     };
 
     class Item7 : public Item
@@ -303,6 +346,12 @@ namespace pksm
                 itemData = LittleEndian::convertTo<u32>(data);
             }
         }
+        explicit Item7(const ItemEntry& entry)
+        {
+            id(entry.id);
+            count(entry.count);
+            itemData |= u32(entry.flags & 0xFFF) << 20;
+        }
         [[nodiscard]] Generation generation(void) const override { return Generation::SEVEN; }
         [[nodiscard]] u16 maxCount(void) const override { return 0x3FF; }
         [[nodiscard]] u16 id(void) const override { return itemData & 0x3FF; }
@@ -327,6 +376,8 @@ namespace pksm
             LittleEndian::convertFrom<u32>(ret.data(), itemData);
             return ret;
         }
+        [[nodiscard]] ItemEntry entry(void) const { return {id(), count(), u16(itemData >> 20)}; }
+        void write(u8* slot) const { LittleEndian::convertFrom<u32>(slot, itemData); }
         [[nodiscard]] operator Item7b(void) const override;
         [[nodiscard]] operator Item8(void) const override;
     };
@@ -352,6 +403,12 @@ namespace pksm
                 itemData = LittleEndian::convertTo<u32>(data);
             }
         }
+        explicit Item7b(const ItemEntry& entry)
+        {
+            id(entry.id);
+            count(entry.count);
+            itemData |= u32(entry.flags & 0x3) << 30;
+        }
         [[nodiscard]] Generation generation(void) const override { return Generation::LGPE; }
         [[nodiscard]] u16 maxCount(void) const override { return 0x7FFF; }
         [[nodiscard]] u16 id(void) const override { return itemData & 0x7FFF; }
@@ -374,6 +431,8 @@ namespace pksm
             LittleEndian::convertFrom<u32>(ret.data(), itemData);
             return ret;
         }
+        [[nodiscard]] ItemEntry entry(void) const { return {id(), count(), u16(itemData >> 30)}; }
+        void write(u8* slot) const { LittleEndian::convertFrom<u32>(slot, itemData); }
         [[nodiscard]] operator Item7(void) const override;
         [[nodiscard]] operator Item8(void) const override;
     };
@@ -399,6 +458,12 @@ namespace pksm
                 itemData = LittleEndian::convertTo<u32>(data);
             }
         }
+        explicit Item8(const ItemEntry& entry)
+        {
+            id(entry.id);
+            count(entry.count);
+            itemData |= u32(entry.flags & 0x3) << 30;
+        }
         [[nodiscard]] Generation generation(void) const override { return Generation::SEVEN; }
         [[nodiscard]] u16 maxCount(void) const override { return 0x7FFF; }
         [[nodiscard]] u16 id(void) const override { return itemData & 0x7FFF; }
@@ -421,6 +486,8 @@ namespace pksm
             LittleEndian::convertFrom<u32>(ret.data(), itemData);
             return ret;
         }
+        [[nodiscard]] ItemEntry entry(void) const { return {id(), count(), u16(itemData >> 30)}; }
+        void write(u8* slot) const { LittleEndian::convertFrom<u32>(slot, itemData); }
         [[nodiscard]] operator Item7(void) const override;
         [[nodiscard]] operator Item7b(void) const override;
     };
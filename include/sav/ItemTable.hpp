@@ -0,0 +1,234 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef ITEMTABLE_HPP
+#define ITEMTABLE_HPP
+
+#include "sav/Sav.hpp"
+#include "utils/coretypes.h"
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+
+namespace pksm
+{
+    // Compile-time pouch legality data for one game. Every pouch's items are kept sorted, with a
+    // bitset per pouch for constant-time membership checks and an item -> pouch reverse index.
+    class ItemTable
+    {
+    public:
+        // Every item ID in every supported game is below this
+        static constexpr u16 ITEM_LIMIT = 2048;
+        static constexpr size_t WORDS   = ITEM_LIMIT / 64;
+        static constexpr size_t POUCHES = size_t(Sav::Pouch::CatchingItem) + 1;
+        static constexpr u8 NO_POUCH    = 0xFF;
+
+        using Bits = std::array<u64, WORDS>;
+
+        constexpr ItemTable(std::span<const Sav::Pouch> pouches, std::span<const u8> slots,
+            std::span<const u16> starts, std::span<const u16> items, std::span<const Bits> bits,
+            std::span<const u8> owners)
+            : pouchList(pouches),
+              slots(slots),
+              starts(starts),
+              itemList(items),
+              bits(bits),
+              owners(owners)
+        {
+        }
+
+        // The pouches this game has, in Pouch order
+        [[nodiscard]] constexpr std::span<const Sav::Pouch> pouches(void) const
+        {
+            return pouchList;
+        }
+
+        // Sorted, without duplicates. Empty if the game does not have the pouch
+        [[nodiscard]] constexpr std::span<const u16> items(Sav::Pouch pouch) const
+        {
+            u8 slot = slots[size_t(pouch)];
+            if (slot == NO_POUCH)
+            {
+                return {};
+            }
+            return itemList.subspan(starts[slot], starts[slot + 1] - starts[slot]);
+        }
+
+        [[nodiscard]] constexpr bool valid(Sav::Pouch pouch, u16 item) const
+        {
+            u8 slot = slots[size_t(pouch)];
+            return slot != NO_POUCH && item < ITEM_LIMIT &&
+                   (bits[slot][item / 64] >> (item % 64)) & 1;
+        }
+
+        // The first pouch, in Pouch order, that can hold the item. A PC only counts if nothing
+        // else can hold it
+        [[nodiscard]] constexpr std::optional<Sav::Pouch> pouchOf(u16 item) const
+        {
+            if (item >= ITEM_LIMIT || owners[item] == NO_POUCH)
+            {
+                return std::nullopt;
+            }
+            return pouchList[owners[item]];
+        }
+
+    private:
+        std::span<const Sav::Pouch> pouchList;
+        std::span<const u8> slots;
+        std::span<const u16> starts;
+        std::span<const u16> itemList;
+        std::span<const Bits> bits;
+        std::span<const u8> owners;
+    };
+
+    template <size_t Count>
+    struct PouchItems
+    {
+        Sav::Pouch pouch;
+        std::array<u16, Count> items;
+    };
+
+    template <size_t Count>
+    PouchItems(Sav::Pouch, std::array<u16, Count>) -> PouchItems<Count>;
+
+    template <size_t PouchCount, size_t ItemCount>
+    struct ItemTableStorage
+    {
+        std::array<Sav::Pouch, PouchCount> pouches;
+        std::array<u8, ItemTable::POUCHES> slots;
+        std::array<u16, PouchCount + 1> starts;
+        std::array<u16, ItemCount> items;
+        std::array<ItemTable::Bits, PouchCount> bits;
+        std::array<u8, ItemTable::ITEM_LIMIT> owners;
+
+        constexpr ItemTable view(void) const
+        {
+            return {pouches, slots, std::span{starts}.first(PouchCount + 1),
+                std::span{items}.first(starts[PouchCount]), bits, owners};
+        }
+    };
+
+    namespace internal
+    {
+        template <size_t PouchCount, size_t ItemCount>
+        consteval void addPouch(ItemTableStorage<PouchCount, ItemCount>& table, size_t& slot,
+            Sav::Pouch pouch, std::span<const u16> items)
+        {
+            table.pouches[slot] = pouch;
+            u16 start           = table.starts[slot];
+            u16 end             = start;
+            for (u16 item : items)
+            {
+                if (!((table.bits[slot][item / 64] >> (item % 64)) & 1))
+                {
+                    table.bits[slot][item / 64] |= u64(1) << (item % 64);
+                    table.items[end++]           = item;
+                }
+            }
+            std::sort(table.items.begin() + start, table.items.begin() + end);
+            table.starts[++slot] = end;
+        }
+
+        template <size_t PouchCount, size_t ItemCount>
+        consteval void finishTable(ItemTableStorage<PouchCount, ItemCount>& table)
+        {
+            std::array<size_t, PouchCount> order{};
+            for (size_t i = 0; i < PouchCount; i++)
+            {
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(),
+                [&table](size_t a, size_t b) { return table.pouches[a] < table.pouches[b]; });
+
+            // Reorder everything into Pouch order so that the reverse index prefers lower pouches
+            ItemTableStorage<PouchCount, ItemCount> sorted{};
+            sorted.slots.fill(ItemTable::NO_POUCH);
+            sorted.owners.fill(ItemTable::NO_POUCH);
+            for (size_t slot = 0; slot < PouchCount; slot++)
+            {
+                size_t from = order[slot];
+                u16 start   = sorted.starts[slot];
+                u16 count   = table.starts[from + 1] - table.starts[from];
+
+                sorted.pouches[slot]                       = table.pouches[from];
+                sorted.slots[size_t(sorted.pouches[slot])] = slot;
+                sorted.bits[slot]                          = table.bits[from];
+                std::copy_n(table.items.begin() + table.starts[from], count,
+                    sorted.items.begin() + start);
+                sorted.starts[slot + 1] = start + count;
+            }
+            for (size_t pass = 0; pass < 2; pass++)
+            {
+                for (size_t slot = 0; slot < PouchCount; slot++)
+                {
+                    if ((sorted.pouches[slot] == Sav::Pouch::PCItem) != (pass == 1))
+                    {
+                        continue;
+                    }
+                    for (u16 i = sorted.starts[slot]; i < sorted.starts[slot + 1]; i++)
+                    {
+                        if (sorted.owners[sorted.items[i]] == ItemTable::NO_POUCH)
+                        {
+                            sorted.owners[sorted.items[i]] = slot;
+                        }
+                    }
+                }
+            }
+            table = sorted;
+        }
+    }
+
+    // Builds a game's table from unsorted pouch lists, which may contain duplicates
+    template <size_t... Counts>
+    consteval ItemTableStorage<sizeof...(Counts), (Counts + ... + 0)> makeItemTable(
+        const PouchItems<Counts>&... pouches)
+    {
+        ItemTableStorage<sizeof...(Counts), (Counts + ... + 0)> ret{};
+        size_t slot = 0;
+        (internal::addPouch(ret, slot, pouches.pouch, pouches.items), ...);
+        internal::finishTable(ret);
+        return ret;
+    }
+
+    // As above, with an added PC that can hold anything the other pouches can
+    template <size_t... Counts>
+    consteval ItemTableStorage<sizeof...(Counts) + 1, 2 * (Counts + ... + 0)> makeItemTableWithPC(
+        const PouchItems<Counts>&... pouches)
+    {
+        ItemTableStorage<sizeof...(Counts) + 1, 2 * (Counts + ... + 0)> ret{};
+        size_t slot = 0;
+        (internal::addPouch(ret, slot, pouches.pouch, pouches.items), ...);
+        std::array<u16, (Counts + ... + 0)> all{};
+        std::copy_n(ret.items.begin(), ret.starts[slot], all.begin());
+        internal::addPouch(
+            ret, slot, Sav::Pouch::PCItem, std::span<const u16>{all}.first(ret.starts[slot]));
+        internal::finishTable(ret);
+        return ret;
+    }
+}
+
+#endif
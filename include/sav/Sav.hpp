@@ -36,18 +36,28 @@
 #include "enums/Species.hpp"
 #include "pkx/PKX.hpp"
 #include "sav/Item.hpp"
+#include "sav/SaveDetection.hpp"
 #include "utils/DateTime.hpp"
 #include "utils/VersionTables.hpp"
 #include "utils/coretypes.h"
 #include "wcx/WCX.hpp"
+#include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <set>
+#include <span>
 #include <type_traits>
 #include <vector>
 
 namespace pksm
 {
+    class ItemTable;
+
+    // Any number of threads may call const member functions, pkm(box, slot) included, on the same
+    // Sav at once, as long as no non-const member function runs at the same time. The PKX objects
+    // it hands out are copies that belong to the caller. With _PKSMCORE_DISABLE_THREAD_SAFETY
+    // defined, a Sav must only be used from one thread at a time.
     class Sav
     {
     protected:
@@ -78,11 +88,15 @@ namespace pksm
 
         const std::shared_ptr<u8[]> data;
         const u32 length;
-        [[nodiscard]] static std::unique_ptr<Sav> checkGBType(
+
+        [[nodiscard]] static std::unique_ptr<Sav> openSave(
             const std::shared_ptr<u8[]>& dt, size_t length);
-        [[nodiscard]] static std::unique_ptr<Sav> checkGBAType(const std::shared_ptr<u8[]>& dt);
-        [[nodiscard]] static std::unique_ptr<Sav> checkDSType(const std::shared_ptr<u8[]>& dt);
-        [[nodiscard]] static bool validSequence(const std::shared_ptr<u8[]>& dt, size_t offset);
+        [[nodiscard]] static std::unique_ptr<Sav> openSave(const std::shared_ptr<u8[]>& dt,
+            size_t length, const SaveCandidate& format, bool scratch);
+
+        // Called after applyBlockDelta rewrites raw blocks. Formats that cache data decoded from
+        // them reload it here; the checksums are then recomputed.
+        virtual void blocksRewritten(void) { finishEditing(); }
 
     public:
         enum class Pouch
@@ -103,6 +117,13 @@ namespace pksm
             RotomPower,
             CatchingItem
         };
+        // Tag for getSave: the save will only be queried, so only the const interface is handed out
+        struct ReadOnly_t
+        {
+            explicit ReadOnly_t() = default;
+        };
+        static constexpr ReadOnly_t ReadOnly{};
+
         enum class BadTransferReason
         {
             OKAY, // Indicates a transfer that should be successful
@@ -111,7 +132,8 @@ namespace pksm
             FORM,
             ABILITY,
             ITEM,
-            BALL
+            BALL,
+            FORMAT // The PKX is not of any known format
         };
 
         virtual ~Sav() = default;
@@ -129,6 +151,13 @@ namespace pksm
         [[nodiscard]] static bool isValidDSSave(const std::shared_ptr<u8[]>& dt);
         [[nodiscard]] static std::unique_ptr<Sav> getSave(
             const std::shared_ptr<u8[]>& dt, size_t length);
+        [[nodiscard]] static std::unique_ptr<const Sav> getSave(
+            const std::shared_ptr<u8[]>& dt, size_t length, ReadOnly_t);
+        // Opens the format detectSaveFormat reported for dt without probing it again. If scratch
+        // is true, dt is a private copy that nothing else reads, which SWSH saves then decode in
+        // place instead of keeping a decoded copy of the whole image (so rawData() is decoded too).
+        [[nodiscard]] static std::unique_ptr<const Sav> getSave(const std::shared_ptr<u8[]>& dt,
+            size_t length, const SaveCandidate& format, ReadOnly_t, bool scratch = false);
 
         [[nodiscard]] virtual u16 TID(void) const             = 0;
         virtual void TID(u16 v)                               = 0;
@@ -175,6 +204,47 @@ namespace pksm
         virtual void pkm(const PKX& pk, u8 slot)                              = 0;
         [[nodiscard]] virtual std::unique_ptr<PKX> pkm(u8 box, u8 slot) const = 0;
         virtual void pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)     = 0;
+        // The stored, possibly encrypted bytes of a box slot. Empty for formats that do not keep
+        // them in one piece (Generations 1 and 2).
+        [[nodiscard]] virtual std::span<const u8> boxSlotData(u8, u8) const { return {}; }
+        // Slots in each box. The last box of LGPE is only partly usable.
+        [[nodiscard]] int boxSlots(void) const { return (maxSlot() + maxBoxes() - 1) / maxBoxes(); }
+
+        // Calls visit(box, slot, pk) for each box slot, skipping empty ones if occupiedOnly is set.
+        // Whole boxes are handed out to threads (0 means one per core) as they finish their
+        // previous one, so visit must be safe to call concurrently and must not throw. Each thread
+        // decrypts every slot into one reused PKX, so pk is only valid during the call. Runs on the
+        // calling thread alone if _PKSMCORE_DISABLE_THREAD_SAFETY is defined.
+        void forEachBoxSlot(const std::function<void(u8 box, u8 slot, const PKX& pk)>& visit,
+            bool occupiedOnly = false, unsigned threads = 0) const;
+        // forEachBoxSlot that collects what visit returns, in slot order
+        template <typename F>
+        [[nodiscard]] auto scanBoxes(
+            F&& visit, bool occupiedOnly = false, unsigned threads = 0) const
+        {
+            using Result = std::invoke_result_t<F&, u8, u8, const PKX&>;
+            static_assert(
+                !std::is_void_v<Result>, "Use forEachBoxSlot for visitors without results");
+            // Each box is visited by a single thread, so its results need no locking
+            std::vector<std::vector<Result>> perBox(maxBoxes());
+            auto collect = [&](u8 box, u8 slot, const PKX& pk) {
+                perBox[box].emplace_back(std::invoke(visit, box, slot, pk));
+            };
+            forEachBoxSlot(collect, occupiedOnly, threads);
+
+            std::vector<Result> ret;
+            size_t total = 0;
+            for (const auto& results : perBox)
+            {
+                total += results.size();
+            }
+            ret.reserve(total);
+            for (auto& results : perBox)
+            {
+                std::move(results.begin(), results.end(), std::back_inserter(ret));
+            }
+            return ret;
+        }
         virtual void trade(PKX& pk,
             const Date& date = Date::today()) const = 0; // Look into bank boolean parameter
         [[nodiscard]] virtual std::unique_ptr<PKX> emptyPkm() const = 0;
@@ -229,13 +299,61 @@ namespace pksm
             return VersionTables::formCount(version(), s);
         }
 
-        virtual void item(const Item& item, Pouch pouch, u16 slot)                     = 0;
-        [[nodiscard]] virtual std::unique_ptr<Item> item(Pouch pouch, u16 slot) const  = 0;
-        [[nodiscard]] virtual std::vector<std::pair<Pouch, int>> pouches(void) const   = 0;
-        [[nodiscard]] virtual std::map<Pouch, std::vector<int>> validItems(void) const = 0;
+        virtual void item(const Item& item, Pouch pouch, u16 slot)                    = 0;
+        [[nodiscard]] virtual std::unique_ptr<Item> item(Pouch pouch, u16 slot) const = 0;
+        [[nodiscard]] virtual std::vector<std::pair<Pouch, int>> pouches(void) const  = 0;
+        // Which items each pouch can hold. Static data: the reference is valid forever
+        [[nodiscard]] virtual const ItemTable& itemTable(void) const = 0;
+        // Copy of itemTable() with each pouch's items in ascending order
+        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const;
+        // Number of slots in the pouch, or 0 if the game does not have it
+        [[nodiscard]] u16 pouchSize(Pouch pouch) const;
+
+        // Whole-pouch access without an Item per slot. Reads the pouch's first out.size() slots and
+        // returns how many there were
+        [[nodiscard]] virtual size_t readPouch(Pouch pouch, std::span<ItemEntry> out) const;
+        // Writes the pouch's first items.size() slots, dropping any that do not fit
+        virtual void writePouch(Pouch pouch, std::span<const ItemEntry> items);
 
         [[nodiscard]] u32 getLength() const { return length; }
         [[nodiscard]] const std::shared_ptr<u8[]>& rawData() const { return data; }
+
+        // A checksummed region of the raw save, not including its checksum
+        struct BlockRange
+        {
+            u32 offset;
+            u32 length;
+        };
+        // The save's checksummed regions, indexed the same way in every save of a format even when
+        // their offsets move between save slots. Empty for formats without a block map.
+        [[nodiscard]] virtual std::vector<BlockRange> blockMap(void) const { return {}; }
+        // Encodes the runs of bytes that differ from base within each block. Both saves are
+        // compared in their raw form, so finishEditing should be called on them first. Empty if
+        // base is from another game or the format has no block map.
+        [[nodiscard]] std::vector<u8> blockDelta(const Sav& base) const;
+        // Applies a blockDelta made against this save and recomputes its checksums. Returns false
+        // and changes nothing if the delta is malformed or its base's blocks don't match this
+        // save's.
+        bool applyBlockDelta(std::span<const u8> delta);
+
+    protected:
+        // Block map for formats that describe their blocks with parallel offset and length tables
+        template <size_t N, typename Length>
+        [[nodiscard]] static std::vector<BlockRange> tableBlockMap(
+            const u32 (&offsets)[N], const Length (&lengths)[N])
+        {
+            std::vector<BlockRange> ret(N);
+            for (size_t i = 0; i < N; i++)
+            {
+                ret[i] = {offsets[i], lengths[i]};
+            }
+            return ret;
+        }
+
+    private:
+        // invalidTransferReason, instantiated for each format class
+        template <typename Pkm>
+        [[nodiscard]] BadTransferReason transferReason(const Pkm& pk) const;
     };
 }
 
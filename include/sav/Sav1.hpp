@@ -45,6 +45,10 @@ namespace pksm
             OFS_PARTY, OFS_CURRENT_BOX, OFS_MAIN_DATA_SUM, OFS_BANK2_BOX_SUMS, OFS_BANK3_BOX_SUMS;
 
         void fixBoxes(void);
+        // Stable, single-pass compaction of a species list and its records, OT names, and nicknames,
+        // moving raw bytes. Returns the number of occupied slots.
+        [[nodiscard]] u8 compactSlots(u32 listOfs, u32 recordOfs, u32 recordLength, u32 otNameOfs,
+            u32 nicknameOfs, u8 count, u8 capacity);
 
         [[nodiscard]] bool getCaught(Species species) const;
         void setCaught(Species species, bool caught);
@@ -54,8 +58,6 @@ namespace pksm
     public:
         Sav1(const std::shared_ptr<u8[]>& data, u32 length);
 
-        [[nodiscard]] static Game getVersion(const std::shared_ptr<u8[]>& dt);
-
         void finishEditing(void) override;
         void beginEditing(void) override {}
 
@@ -143,7 +145,7 @@ namespace pksm
         void item(const Item& tItem, Pouch pouch, u16 slot) override;
         [[nodiscard]] std::unique_ptr<Item> item(Pouch pouch, u16 slot) const override;
         [[nodiscard]] std::vector<std::pair<Pouch, int>> pouches(void) const override;
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const override;
+        [[nodiscard]] const ItemTable& itemTable(void) const override;
         // Gen I Item IDs
         [[nodiscard]] std::map<Pouch, std::vector<int>> validItems1(void) const;
         void fixItemLists(void);
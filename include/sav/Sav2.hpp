@@ -47,6 +47,10 @@ namespace pksm
             OFS_CHECKSUM_TWO, OFS_CHECKSUM_END, OFS_TIME_PLAYED, OFS_PALETTE, OFS_TID, OFS_NAME;
 
         void fixBoxes(void);
+        // Stable, single-pass compaction of a species list and its records, OT names, and nicknames,
+        // moving raw bytes. Returns the number of occupied slots.
+        [[nodiscard]] u8 compactSlots(u32 listOfs, u32 recordOfs, u32 recordLength, u32 otNameOfs,
+            u32 nicknameOfs, u8 count, u8 capacity);
 
         [[nodiscard]] bool getCaught(Species species) const;
         void setCaught(Species species, bool caught);
@@ -59,10 +63,6 @@ namespace pksm
         Sav2(const std::shared_ptr<u8[]>& data, u32 length,
             std::tuple<GameVersion, Language, bool> versionAndLanguage);
 
-        [[nodiscard]] static std::tuple<GameVersion, Language, bool> getVersion(
-            const std::shared_ptr<u8[]>& dt);
-        [[nodiscard]] static bool validList(const std::shared_ptr<u8[]>& dt, size_t ofs, u8 slot);
-
         void finishEditing(void) override;
         void beginEditing(void) override {}
 
@@ -147,10 +147,7 @@ namespace pksm
         void item(const Item& tItem, Pouch pouch, u16 slot) override;
         [[nodiscard]] std::unique_ptr<Item> item(Pouch pouch, u16 slot) const override;
         [[nodiscard]] std::vector<std::pair<Pouch, int>> pouches(void) const override;
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const override;
-
-        // Gen II Item IDs
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems2(void) const;
+        [[nodiscard]] const ItemTable& itemTable(void) const override;
 
         // apparently weird stuff happens if you ignore this
         [[nodiscard]] u8 pouchEntryCount(Pouch pouch) const;
@@ -28,6 +28,7 @@
 #define SAV3_HPP
 
 #include "personal/personal.hpp"
+#include "pkx/PK3.hpp"
 #include "sav/Sav.hpp"
 #include <array>
 
@@ -77,9 +78,36 @@ namespace pksm
 
         [[nodiscard]] int ABO() const { return activeSAV * SIZE_BLOCK * BLOCK_COUNT; };
 
+        // The PC spans blocks 5-13 with no regard for sector boundaries, so it is gathered into one
+        // contiguous buffer on load. Writes to it mark the sectors they touch, and only those are
+        // scattered back (and re-checksummed) by finishEditing, along with any sectors handed out
+        // by getBlock.
+        static constexpr int PC_BLOCK_START = 5;
+        static constexpr int PC_BLOCK_COUNT = BLOCK_COUNT - PC_BLOCK_START;
+        static constexpr int SIZE_PC =
+            (PC_BLOCK_COUNT - 1) * SIZE_BLOCK_USED + chunkLength[BLOCK_COUNT - 1];
+
+        std::unique_ptr<u8[]> pcData;
+        u16 dirtyPCBlocks = 0;
+        u16 rawPCBlocks   = 0;
+
+        void loadPC(u16 pcBlocks = (1 << PC_BLOCK_COUNT) - 1);
+        // Returns a mask of the PC blocks written back
+        u16 storePC();
+        void markPCDirty(int ofs, int length);
+        void resignBlocks(u16 pcBlocks);
+        void blocksRewritten(void) override;
+        [[nodiscard]] static constexpr int pcOffset(u8 box, u8 slot)
+        {
+            return 4 + PK3::BOX_LENGTH * (box * 30 + slot);
+        }
+        [[nodiscard]] int boxNameOffset(u8 box) const { return pcOffset(maxBoxes(), 0) + box * 9; }
+
         int activeSAV;
 
         [[nodiscard]] u32 securityKey() const;
+        [[nodiscard]] u8* pouchStart(Pouch pouch) const;
+        [[nodiscard]] u16 pouchKey(Pouch pouch) const;
 
         [[nodiscard]] bool getEventFlag(int flagNumber) const;
         void setEventFlag(int flagNumber, bool value);
@@ -100,13 +128,19 @@ namespace pksm
 
     public:
         static constexpr int SIZE_BLOCK = 0x1000;
-        [[nodiscard]] static Game getVersion(const std::shared_ptr<u8[]>& dt);
 
+        // Stores the PC, rereads it from the raw image and recomputes every checksum. Call this after
+        // writing to rawData() directly.
         void resign(void);
-        void finishEditing(void) override { resign(); }
+        void finishEditing(void) override;
         void beginEditing(void) override {}
+        // The active slot's 14 blocks in logical order, then the two Hall of Fame blocks. Blocks
+        // that are not initialized yet are empty.
+        [[nodiscard]] std::vector<BlockRange> blockMap(void) const override;
 
-        [[nodiscard]] u8* getBlock(size_t blockNum) { return &data[blockOfs[blockNum]]; }
+        // Writes to PC blocks (5-13) through this are checksummed and reread into the PC by the next
+        // finishEditing. Box edits made in between take precedence.
+        [[nodiscard]] u8* getBlock(size_t blockNum);
 
         [[nodiscard]] u16 TID(void) const override;
         void TID(u16 v) override;
@@ -147,11 +181,14 @@ namespace pksm
         // + PK3::BOX_LENGTH > 0xF80 In this case, the first 0xF80 - RETURNVALUE bytes of a Pokemon
         // should be written to the returned offset, with the remainder written to offset
         // boxOffset(box + (slot + 1) / 30, (slot + 1) % 30) & 0xFFFFF000
+        // Sav3 itself works on a contiguous copy of the PC, so this is only meaningful for the
+        // raw data after finishEditing
         [[nodiscard]] u32 boxOffset(u8 box, u8 slot) const override;
         [[nodiscard]] u32 partyOffset(u8 slot) const override;
 
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] std::span<const u8> boxSlotData(u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a ekx
         // that's because PKSM works with decrypted boxes and
@@ -182,6 +219,8 @@ namespace pksm
 
         void item(const Item& item, Pouch pouch, u16 slot) override;
         [[nodiscard]] std::unique_ptr<Item> item(Pouch pouch, u16 slot) const override;
+        [[nodiscard]] size_t readPouch(Pouch pouch, std::span<ItemEntry> out) const override;
+        void writePouch(Pouch pouch, std::span<const ItemEntry> items) override;
         [[nodiscard]] std::vector<std::pair<Pouch, int>> pouches(void) const override;
         // G3 item IDs
         [[nodiscard]] virtual std::map<Pouch, std::vector<int>> validItems3(void) const = 0;
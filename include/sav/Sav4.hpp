@@ -45,6 +45,8 @@ namespace pksm
         void GBO(void);
         void SBO(void);
 
+        [[nodiscard]] u8* pouchStart(Pouch pouch) const;
+
         [[nodiscard]] bool checkInsertForm(std::vector<u8>& forms, u8 formNum);
         [[nodiscard]] std::vector<u8> getForms(Species species);
         [[nodiscard]] std::vector<u8> getDexFormValues(u32 v, u8 bitsPerForm, u8 readCt);
@@ -65,6 +67,8 @@ namespace pksm
         void resign(void);
         void finishEditing(void) override { resign(); }
         void beginEditing(void) override {}
+        // The active general and storage blocks, up to their footers
+        [[nodiscard]] std::vector<BlockRange> blockMap(void) const override;
 
         [[nodiscard]] u16 TID(void) const override;
         void TID(u16 v) override;
@@ -106,6 +110,7 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] std::span<const u8> boxSlotData(u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a ekx
         // that's because PKSM works with decrypted boxes and
@@ -140,8 +145,9 @@ namespace pksm
 
         void item(const Item& item, Pouch pouch, u16 slot) override;
         [[nodiscard]] std::unique_ptr<Item> item(Pouch pouch, u16 slot) const override;
+        [[nodiscard]] size_t readPouch(Pouch pouch, std::span<ItemEntry> out) const override;
+        void writePouch(Pouch pouch, std::span<const ItemEntry> items) override;
         [[nodiscard]] std::vector<std::pair<Pouch, int>> pouches(void) const override;
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const override;
     };
 }
 
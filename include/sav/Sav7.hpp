@@ -45,6 +45,7 @@ namespace pksm
         void setDexFlags(int index, int gender, int shiny, int baseSpecies);
         [[nodiscard]] int getDexFlags(int index, int baseSpecies) const;
         bool sanitizeFormsToIterate(Species species, int& fs, int& fe, int formIn) const;
+        [[nodiscard]] u8* pouchStart(Pouch pouch) const;
 
     public:
         Sav7(const std::shared_ptr<u8[]>& data, u32 length) : Sav(data, length) {}
@@ -93,6 +94,7 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] std::span<const u8> boxSlotData(u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a ekx
         // that's because PKSM works with decrypted boxes and
@@ -123,6 +125,8 @@ namespace pksm
 
         void item(const Item& item, Pouch pouch, u16 slot) override;
         [[nodiscard]] std::unique_ptr<Item> item(Pouch pouch, u16 slot) const override;
+        [[nodiscard]] size_t readPouch(Pouch pouch, std::span<ItemEntry> out) const override;
+        void writePouch(Pouch pouch, std::span<const ItemEntry> items) override;
         [[nodiscard]] std::vector<std::pair<Pouch, int>> pouches(void) const override;
     };
 }
@@ -36,16 +36,34 @@ namespace pksm
     class Sav8 : public Sav
     {
     protected:
-        std::vector<std::shared_ptr<pksm::crypto::swsh::SCBlock>> blocks;
+        // Decrypted working copy of the save. Blocks live here so that the backing store (which may
+        // be a private file mapping) is only written by finishEditing.
+        std::shared_ptr<u8[]> overlay;
+        // Blocks decrypt themselves on first access, including from const getters. That is
+        // guarded, so concurrent const reads stay safe.
+        mutable std::vector<pksm::crypto::swsh::SCBlock> blocks;
 
         int Items, BoxLayout, Misc, TrainerCard, PlayTime, Status;
 
         bool encrypted = false;
 
     public:
-        Sav8(const std::shared_ptr<u8[]>& dt, size_t length);
+        // Each block stays encrypted until its data is first requested. If inPlace is true, dt is a
+        // scratch copy that becomes the overlay instead of being copied
+        Sav8(const std::shared_ptr<u8[]>& dt, size_t length, bool inPlace = false);
 
-        [[nodiscard]] std::shared_ptr<pksm::crypto::swsh::SCBlock> getBlock(u32 key) const;
+        // Returns nullptr if no block has that key
+        [[nodiscard]] pksm::crypto::swsh::SCBlock* getBlock(u32 key) const;
+
+        // Serializes every block that differs from base into a patch that turns base into this
+        // save. Both saves must be in editing mode and share a block layout; otherwise the result
+        // is empty.
+        [[nodiscard]] std::vector<u8> blockDiff(const Sav8& base) const;
+        // Applies a blockDiff patch made against this save. Blocks decrypt lazily, so only the
+        // patched ones and any others read since beginEditing are re-encrypted by finishEditing.
+        // Returns false and changes nothing if the patch
+        // is malformed, was made against a different save, or the save is not in editing mode.
+        bool applyBlockPatch(std::span<const u8> patch);
 
         void finishEditing(void) override;
         void beginEditing(void) override;
@@ -76,8 +76,12 @@ namespace pksm
         explicit SavBW(const std::shared_ptr<u8[]>& dt);
 
         void resign(void) override;
+        [[nodiscard]] std::vector<BlockRange> blockMap(void) const override
+        {
+            return tableBlockMap(blockOfs, lengths);
+        }
 
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const override;
+        [[nodiscard]] const ItemTable& itemTable(void) const override;
     };
 }
 
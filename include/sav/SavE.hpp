@@ -36,7 +36,7 @@ namespace pksm
     public:
         explicit SavE(const std::shared_ptr<u8[]>& dt);
 
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const override;
+        [[nodiscard]] const ItemTable& itemTable(void) const override;
         [[nodiscard]] std::map<Pouch, std::vector<int>> validItems3(void) const override;
     };
 }
@@ -53,11 +53,17 @@ namespace pksm
         void setDexFlags(int index, int gender, int shiny, int baseSpecies);
         bool sanitizeFormsToIterate(Species species, int& fs, int& fe, int formIn) const;
 
+        [[nodiscard]] u8* pouchStart(Pouch pouch) const;
+
     public:
         SavLGPE(const std::shared_ptr<u8[]>& dt, size_t length);
         void resign(void);
         void finishEditing(void) override { resign(); }
         void beginEditing(void) override {}
+        [[nodiscard]] std::vector<BlockRange> blockMap(void) const override
+        {
+            return tableBlockMap(chkofs, chklen);
+        }
 
         [[nodiscard]] u16 boxedPkm(void) const;
         void boxedPkm(u16 v);
@@ -109,6 +115,7 @@ namespace pksm
         // Will never be encrypted: part of normal box stuff
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] std::span<const u8> boxSlotData(u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a pkx
         // that's because PKSM works with decrypted boxes and
@@ -147,8 +154,10 @@ namespace pksm
 
         void item(const Item& item, Pouch pouch, u16 slot) override;
         [[nodiscard]] std::unique_ptr<Item> item(Pouch pouch, u16 slot) const override;
+        [[nodiscard]] size_t readPouch(Pouch pouch, std::span<ItemEntry> out) const override;
+        void writePouch(Pouch pouch, std::span<const ItemEntry> items) override;
         [[nodiscard]] std::vector<std::pair<Pouch, int>> pouches(void) const override;
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const override;
+        [[nodiscard]] const ItemTable& itemTable(void) const override;
     };
 }
 
@@ -54,8 +54,12 @@ namespace pksm
         explicit SavORAS(const std::shared_ptr<u8[]>& dt);
 
         void resign(void) override;
+        [[nodiscard]] std::vector<BlockRange> blockMap(void) const override
+        {
+            return tableBlockMap(chkofs, chklen);
+        }
 
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const override;
+        [[nodiscard]] const ItemTable& itemTable(void) const override;
     };
 }
 
@@ -38,6 +38,8 @@ namespace pksm
         static constexpr std::array<u16, 25> gigaSpecies = {6, 12, 25, 52, 68, 94, 99, 131, 133,
             143, 569, 823, 826, 834, 839, 841, 842, 844, 851, 858, 861, 869, 879, 884, 890};
 
+        [[nodiscard]] u8* pouchStart(Pouch pouch) const;
+
     public:
         static constexpr size_t SIZE_G8SWSH    = 0x1716B3; // 1.0
         static constexpr size_t SIZE_G8SWSH_1  = 0x17195E; // 1.0 -> 1.1
@@ -48,7 +50,7 @@ namespace pksm
         static constexpr size_t SIZE_G8SWSH_3B = 0x187668; // 1.0 -> 1.2 -> 1.3
         static constexpr size_t SIZE_G8SWSH_3C = 0x18764A; // 1.0 -> 1.3
 
-        SavSWSH(const std::shared_ptr<u8[]>& dt, size_t length);
+        SavSWSH(const std::shared_ptr<u8[]>& dt, size_t length, bool inPlace = false);
 
         [[nodiscard]] u16 TID(void) const override;
         void TID(u16 v) override;
@@ -79,8 +81,10 @@ namespace pksm
 
         void item(const Item& item, Pouch pouch, u16 slot) override;
         [[nodiscard]] std::unique_ptr<Item> item(Pouch pouch, u16 slot) const override;
+        [[nodiscard]] size_t readPouch(Pouch pouch, std::span<ItemEntry> out) const override;
+        void writePouch(Pouch pouch, std::span<const ItemEntry> items) override;
         [[nodiscard]] std::vector<std::pair<Pouch, int>> pouches(void) const override;
-        [[nodiscard]] std::map<Pouch, std::vector<int>> validItems(void) const override;
+        [[nodiscard]] const ItemTable& itemTable(void) const override;
 
         [[nodiscard]] u8 subRegion(void) const override { return 0; }     // Not applicable
         void subRegion(u8) override {}                                    // Not applicable
@@ -107,6 +111,7 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] std::span<const u8> boxSlotData(u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a ekx
         // that's because PKSM works with decrypted boxes and
@@ -0,0 +1,124 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+
+#ifndef SAVEBATCH_HPP
+#define SAVEBATCH_HPP
+
+#include "sav/SaveDetection.hpp"
+#include "utils/coretypes.h"
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace pksm
+{
+    class Sav;
+
+    // Runs the same read-only query over many saves of any format. Saves are opened, queried and
+    // closed one at a time per thread, so at most one save per thread is in memory at once: files
+    // are only mapped while their save is open, and in-memory images are copied into a buffer each
+    // thread reuses. Each save is opened as the format detection reported, without probing again,
+    // and SWSH saves decode that private buffer or mapping in place rather than copying it once
+    // more. The i18n data and the game tables queries use are global and shared.
+    class SaveBatch
+    {
+    public:
+        enum class Error : u8
+        {
+            None,
+            Unreadable,   // The file could not be opened or mapped, or the image is empty
+            Unrecognized, // detectSaveFormat found no format
+            Corrupt       // The detected format's data could not be parsed
+        };
+
+        struct Status
+        {
+            Error error       = Error::None;
+            SaveFormat format = SaveFormat::RGBY; // Only meaningful if error is Error::None
+        };
+
+        template <typename T>
+        struct Result
+        {
+            Error error       = Error::None;
+            SaveFormat format = SaveFormat::RGBY;
+            std::optional<T> value; // Empty unless error is Error::None
+        };
+
+        // Queues the save file at path. Nothing is read until the batch runs.
+        void add(std::string path);
+        // Queues a save image. The batch opens a copy, so data is never changed and may be queued
+        // more than once.
+        void add(std::shared_ptr<u8[]> data, size_t length);
+
+        [[nodiscard]] size_t size(void) const { return inputs.size(); }
+        void clear(void) { inputs.clear(); }
+
+        // Calls query(index, save) for every queued save that opens, where index is its position
+        // in the queue. Saves are spread over threads (0 means one per core), so query must be
+        // safe to call concurrently and must not throw. save is destroyed when query returns.
+        // Returns each input's status in queue order. Runs on the calling thread alone if
+        // _PKSMCORE_DISABLE_THREAD_SAFETY is defined.
+        std::vector<Status> forEach(const std::function<void(size_t index, const Sav& save)>& query,
+            unsigned threads = 0) const;
+
+        // forEach that collects what query(save) returns, in queue order
+        template <typename F>
+        [[nodiscard]] auto run(F&& query, unsigned threads = 0) const
+        {
+            using T = std::invoke_result_t<F&, const Sav&>;
+            static_assert(!std::is_void_v<T>, "Use forEach for queries without results");
+            // Each slot is written by the one thread that opened its save
+            std::vector<Result<T>> ret(inputs.size());
+            auto collect = [&](size_t index, const Sav& save) {
+                ret[index].value.emplace(std::invoke(query, save));
+            };
+            std::vector<Status> statuses = forEach(collect, threads);
+            for (size_t i = 0; i < statuses.size(); i++)
+            {
+                ret[i].error  = statuses[i].error;
+                ret[i].format = statuses[i].format;
+            }
+            return ret;
+        }
+
+    private:
+        struct Input
+        {
+            std::string path; // Empty for in-memory images
+            std::shared_ptr<u8[]> data;
+            size_t length = 0;
+        };
+
+        std::vector<Input> inputs;
+    };
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef SAVEDETECTION_HPP
+#define SAVEDETECTION_HPP
+
+#include "enums/GameVersion.hpp"
+#include "enums/Language.hpp"
+#include "utils/coretypes.h"
+#include <span>
+#include <vector>
+
+namespace pksm
+{
+    enum class SaveFormat : u8
+    {
+        RGBY,
+        GSC,
+        RS,
+        E,
+        FRLG,
+        DP,
+        Pt,
+        HGSS,
+        BW,
+        B2W2,
+        XY,
+        ORAS,
+        SM,
+        USUM,
+        LGPE,
+        SWSH
+    };
+
+    struct SaveCandidate
+    {
+        SaveFormat format;
+        // 0-100. Size-only matches score lowest; matching structure and checksums score highest.
+        u8 confidence;
+        // Only filled in when the probes can tell; otherwise GameVersion::INVALID/Language::None
+        GameVersion version;
+        Language language;
+    };
+
+    // Identifies the format of a raw save image without constructing a Sav. Only a handful of
+    // fixed offsets are read, so this is safe to run on a memory-mapped file. Candidates are sorted
+    // by descending confidence; an empty result means the data is not a recognized save.
+    [[nodiscard]] std::vector<SaveCandidate> detectSaveFormat(std::span<const u8> data);
+}
+
+#endif
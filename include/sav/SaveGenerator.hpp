@@ -0,0 +1,60 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+
+#ifndef SAVEGENERATOR_HPP
+#define SAVEGENERATOR_HPP
+
+#include "sav/SaveDetection.hpp"
+#include "utils/coretypes.h"
+#include <memory>
+
+namespace pksm
+{
+    class PKX;
+    class Sav;
+
+    // Synthetic saves for load testing and fuzzing. Images are built from scratch with only the
+    // structure that detectSaveFormat and the save classes look for; everything else is zero, so
+    // Sav::getSave opens the resulting rawData() as the requested format.
+
+    // An empty English save on which finishEditing has been called. A format always produces the
+    // same bytes.
+    [[nodiscard]] std::unique_ptr<Sav> blankSave(SaveFormat format);
+
+    // A Pokémon the save's own trainer caught: species, moves, level, IVs, nature, gender and
+    // ability are drawn from pksm::randomNumber and the game's tables, and the PID agrees with
+    // them. Moves are not checked against the species' learnset. Nothing is written to the save.
+    [[nodiscard]] std::unique_ptr<PKX> randomPkm(const Sav& save);
+
+    // A blankSave with a random trainer whose first count box slots, in box order, hold
+    // randomPkm results. Reseeds pksm::seedRand with seed first, so equal arguments always give
+    // byte-identical saves. Like blankSave, it comes back finished: call beginEditing before
+    // reading or changing it.
+    [[nodiscard]] std::unique_ptr<Sav> generateSave(SaveFormat format, u32 seed, int count);
+}
+
+#endif
@@ -0,0 +1,159 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+
+#ifndef COUNTERS_HPP
+#define COUNTERS_HPP
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#include "utils/coretypes.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+
+// Hot-path instrumentation, compiled in only when _PKSMCORE_ENABLE_COUNTERS is defined. Without
+// it every hook below is an empty inline function and snapshot() always returns zeros.
+namespace pksm::counters
+{
+    enum class Counter : u8
+    {
+        SCBlockDecrypts,     // SWSH blocks decrypted; timed
+        PKXAllocations,      // PKX data buffers allocated; directAccess views are not counted
+        PKXClones,           // PKX::clone calls
+        CryptBytes,          // bytes run through crypto::pkm::crypt
+        ChecksumBytes,       // bytes hashed by the checksum functions and SHA256; timed
+        I18nLookups,         // i18n calls that look a string or table up
+        I18nMisses,          // lookups that fell back to an empty string
+        RandomPIDIterations, // candidate PIDs drawn by PKX::getRandomPID
+        COUNT
+    };
+
+    struct Snapshot
+    {
+        std::array<u64, size_t(Counter::COUNT)> counts{};
+        // Only the counters marked as timed accumulate time
+        std::array<u64, size_t(Counter::COUNT)> nanoseconds{};
+
+        [[nodiscard]] u64 count(Counter counter) const { return counts[size_t(counter)]; }
+        [[nodiscard]] u64 ns(Counter counter) const { return nanoseconds[size_t(counter)]; }
+    };
+
+    [[nodiscard]] const char* name(Counter counter);
+
+    [[nodiscard]] constexpr bool enabled()
+    {
+#ifdef _PKSMCORE_ENABLE_COUNTERS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Counters are kept per thread (unless _PKSMCORE_DISABLE_THREAD_SAFETY is defined), so these
+    // only see and clear the calling thread's
+    [[nodiscard]] Snapshot snapshot();
+    void reset();
+    // Sums the counters of every thread, including threads that have exited, such as the workers
+    // of Sav::forEachBoxSlot and SaveBatch. reset() does not clear other threads, so measure a
+    // span of work as the difference of two of these.
+    [[nodiscard]] Snapshot snapshotAll();
+
+#ifdef _PKSMCORE_ENABLE_COUNTERS
+    namespace internal
+    {
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        extern constinit Snapshot current;
+
+        inline void bump(u64& value, u64 n)
+        {
+            value += n;
+        }
+#else
+        extern constinit thread_local Snapshot current;
+        extern constinit thread_local bool registered;
+
+        // Makes the calling thread's counters visible to snapshotAll
+        void registerThread();
+
+        // Only the owning thread writes its counters, but snapshotAll reads them from others
+        inline void bump(u64& value, u64 n)
+        {
+            if (!registered)
+            {
+                registerThread();
+            }
+            std::atomic_ref(value).store(value + n, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    constexpr void add(Counter counter, u64 n = 1)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            internal::bump(internal::current.counts[size_t(counter)], n);
+        }
+    }
+
+    // Adds n to the counter now and the time until it is destroyed to the counter's time
+    class Timed
+    {
+    public:
+        explicit Timed(Counter counter, u64 n = 1)
+            : counter(counter), start(std::chrono::steady_clock::now())
+        {
+            add(counter, n);
+        }
+        ~Timed()
+        {
+            internal::bump(internal::current.nanoseconds[size_t(counter)],
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count());
+        }
+        Timed(const Timed&)            = delete;
+        Timed& operator=(const Timed&) = delete;
+
+    private:
+        Counter counter;
+        std::chrono::steady_clock::time_point start;
+    };
+#else
+    constexpr void add(Counter, u64 = 1) {}
+
+    class Timed
+    {
+    public:
+        explicit Timed(Counter, u64 = 1) {}
+    };
+#endif
+}
+
+#endif
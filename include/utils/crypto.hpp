@@ -28,7 +28,9 @@
 #define CRYPTO_HPP
 
 #include "utils/coretypes.h"
+#include "utils/counters.hpp"
 #include <array>
+#include <iterator>
 #include <memory>
 #include <span>
 #include <string>
@@ -73,10 +75,13 @@ namespace pksm::crypto
 
     namespace swsh
     {
+        struct SCBlockDescriptor;
+        class SCBlockIterator;
+
         class SCBlock
         {
-            friend std::vector<std::shared_ptr<SCBlock>> getBlockList(
-                std::shared_ptr<u8[]> data, size_t length);
+            friend std::vector<SCBlock> getBlockList(std::span<u8> data, bool decrypt);
+            friend class SCBlockIterator;
 
         public:
             enum class SCBlockType : u8
@@ -102,8 +107,14 @@ namespace pksm::crypto
                 Float  = 16,
                 Double = 17,
             };
+            friend size_t writeBlock(std::span<u8> out, u32 key, SCBlockType type, u32 dataSize);
+
+            SCBlock(SCBlock&&) noexcept            = default;
+            SCBlock& operator=(SCBlock&&) noexcept = default;
+
             u32 key() const;
-            // Nop if in proper state
+            // Nop if in proper state. decrypt may race with other decrypts of the same block, and
+            // only one of them does the work; encrypt must not race with anything.
             void encrypt();
             void decrypt();
 
@@ -112,35 +123,131 @@ namespace pksm::crypto
                 decrypt();
                 return rawData();
             }
+            [[nodiscard]] SCBlockType blockType() const { return type; }
+            // Only switches between Bool1 and Bool2, which carry their value in the type
+            void blockType(SCBlockType v);
+            // Size of the data region in bytes
+            [[nodiscard]] size_t size() const { return dataSize; }
+            // Compares blocks with the same key. The encryption stream depends only on the key, so
+            // blocks in the same state are compared without decrypting them.
+            [[nodiscard]] bool sameContents(SCBlock& other);
 
         private:
-            SCBlock(std::shared_ptr<u8[]> data, size_t& offset);
+            SCBlock(const SCBlockDescriptor& descriptor, bool decryptNow);
             SCBlock(const SCBlock&)            = delete;
             SCBlock& operator=(const SCBlock&) = delete;
 
             // Returns pointer to data at the beginning of the block's data region, skipping block
             // identifying information
-            u8* rawData() const { return data.get() + myOffset + headerSize(type); }
+            u8* rawData() const { return block + headerSize(type); }
             void key(u32 v);
-            // data.get() + myOffset points to the beginning of the block data: *(u32*)(data.get() +
-            // myOffset) == key
-            std::shared_ptr<u8[]> data = nullptr;
-            size_t myOffset;
-            size_t dataLength;
+            // Reads the header of the still-encrypted block starting at block, without touching its
+            // data
+            static SCBlockDescriptor readHeader(u8* block);
+            // Points into the save buffer, which must outlive the block: *(u32*)block == key
+            u8* block;
+            u32 dataSize;
             SCBlockType type;
             SCBlockType subtype;
-            bool currentlyEncrypted = false;
+            // The first decrypt moves a block from Encrypted through Decrypting to Decrypted, and
+            // concurrent decrypts of the same block wait on it rather than on a shared lock. Always
+            // accessed through loadState/storeState (std::atomic_ref), which keeps SCBlock movable
+            enum class CryptState : u8
+            {
+                Encrypted,
+                Decrypting,
+                Decrypted
+            };
+            CryptState state = CryptState::Encrypted;
+
+            [[nodiscard]] CryptState loadState(void) const;
+            void storeState(CryptState v);
+            // XORs everything after the key with the key's stream, which both encrypts and decrypts
+            void applyKeystream(void);
 
-            size_t encryptedDataSize();
+            size_t encryptedDataSize() const { return headerSize(type) + dataSize; }
             static size_t arrayEntrySize(SCBlockType type);
             static size_t headerSize(SCBlockType type);
         };
 
+        // One block as laid out in the save. data is the block's data region and stays encrypted
+        // until the block is decrypted; Bool types store their value in the type and have none.
+        struct SCBlockDescriptor
+        {
+            u32 key;
+            SCBlock::SCBlockType type;
+            SCBlock::SCBlockType subtype;
+            std::span<u8> data;
+        };
+
+        // Walks the blocks of an xor-decoded save in file order, reading only block headers. Every
+        // block must still be encrypted. Nothing is allocated.
+        class SCBlockIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = SCBlockDescriptor;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const SCBlockDescriptor*;
+            using reference         = const SCBlockDescriptor&;
+
+            SCBlockIterator() = default;
+            // end is the offset the block list stops at, which is the save length minus its hash
+            SCBlockIterator(u8* data, size_t offset, size_t end);
+
+            reference operator*() const { return current; }
+            pointer operator->() const { return &current; }
+            SCBlockIterator& operator++();
+            SCBlockIterator operator++(int)
+            {
+                SCBlockIterator ret = *this;
+                ++*this;
+                return ret;
+            }
+            bool operator==(const SCBlockIterator& other) const { return offset == other.offset; }
+
+        private:
+            void read();
+
+            u8* data       = nullptr;
+            size_t offset  = 0;
+            size_t end     = 0;
+            size_t nextOfs = 0;
+            SCBlockDescriptor current{};
+        };
+
+        class SCBlockRange
+        {
+        public:
+            explicit SCBlockRange(std::span<u8> data)
+                : data(data), limit(data.size() > 32 ? data.size() - 32 : 0)
+            {
+            }
+
+            [[nodiscard]] SCBlockIterator begin() const { return {data.data(), 0, limit}; }
+            [[nodiscard]] SCBlockIterator end() const { return {data.data(), limit, limit}; }
+
+        private:
+            std::span<u8> data;
+            size_t limit;
+        };
+
         void applyXor(std::shared_ptr<u8[]> data, size_t length);
         void sign(std::shared_ptr<u8[]> data, size_t length);
         [[nodiscard]] bool verify(std::shared_ptr<u8[]> data, size_t length);
-        [[nodiscard]] std::vector<std::shared_ptr<SCBlock>> getBlockList(
-            std::shared_ptr<u8[]> data, size_t length);
+        // Streams the blocks of an xor-decoded save, including its trailing hash
+        [[nodiscard]] inline SCBlockRange blocks(std::span<u8> data)
+        {
+            return SCBlockRange{data};
+        }
+        // Builds a flat, key-ordered index of the blocks in data, which must outlive it. If decrypt
+        // is false, only block headers are read and each block is decrypted the first time its
+        // data is requested.
+        [[nodiscard]] std::vector<SCBlock> getBlockList(std::span<u8> data, bool decrypt = true);
+        // Writes an encrypted block holding zeroed data to the start of out and returns its size.
+        // dataSize is only used by Objects; Arrays are not supported. Returns 0 if it does not fit.
+        size_t writeBlock(
+            std::span<u8> out, u32 key, SCBlock::SCBlockType type, u32 dataSize = 0);
     }
 
     namespace pkm
@@ -182,6 +289,7 @@ namespace pksm::crypto
         template <size_t Size>
         constexpr void crypt(u8* data, u32 key)
         {
+            counters::add(counters::Counter::CryptBytes, Size);
             for (size_t i = 0; i < Size; i += 2)
             {
                 key = seedStep(key);
@@ -193,6 +301,7 @@ namespace pksm::crypto
         [[deprecated("Use the templated version wherever possible")]] constexpr void crypt(
             std::span<u8> data, u32 key)
         {
+            counters::add(counters::Counter::CryptBytes, data.size());
             for (size_t i = 0; i < data.size(); i += 2)
             {
                 key = seedStep(key);
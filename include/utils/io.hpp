@@ -27,11 +27,21 @@
 #ifndef IO_HPP
 #define IO_HPP
 
+#include "utils/coretypes.h"
+#include <memory>
 #include <string>
+#include <utility>
 
 namespace io
 {
     [[nodiscard]] bool exists(const std::string& name);
+
+    // Maps a save file for use as a Sav's backing store. Non-writable maps are private: pages are
+    // only faulted in when read, and anything written to them stays in copy-on-write pages instead
+    // of reaching the file. Writable maps are shared and write through. Where mmap is unavailable
+    // the file is read into memory instead. Returns {nullptr, 0} on failure.
+    [[nodiscard]] std::pair<std::shared_ptr<u8[]>, size_t> mapFile(
+        const std::string& name, bool writable = false);
 }
 
 #endif
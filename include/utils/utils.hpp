@@ -35,6 +35,7 @@
 #include <locale>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdarg.h>
 #include <string.h>
 #include <string>
@@ -113,6 +114,30 @@ namespace StringUtils
 
     [[nodiscard]] std::string getString4(const u8* data, int ofs, int len);
     void setString4(u8* data, const std::string_view& v, int ofs, int len);
+
+    // Which of transString45/transString67's character swaps to apply
+    enum class CharSwap : u8
+    {
+        None,
+        Gen45,
+        Gen67
+    };
+
+    // Single-pass versions of transStringXX(getString(...)) and setString(transStringXX(...)) and
+    // their Generation 4 equivalents. The span overloads write UTF-8 to out, truncating at a
+    // codepoint boundary if it is too small, and return the number of bytes written. They never
+    // allocate; the std::string overloads only do when the result doesn't fit in the small string
+    // buffer.
+    [[nodiscard]] size_t getString(
+        std::span<char> out, const u8* data, int ofs, int len, char16_t term, CharSwap swap);
+    [[nodiscard]] std::string getString(
+        const u8* data, int ofs, int len, char16_t term, CharSwap swap);
+    void setString(u8* data, const std::string_view& v, int ofs, int len, char16_t terminator,
+        char16_t padding, CharSwap swap);
+    [[nodiscard]] size_t getString4(
+        std::span<char> out, const u8* data, int ofs, int len, CharSwap swap);
+    [[nodiscard]] std::string getString4(const u8* data, int ofs, int len, CharSwap swap);
+    void setString4(u8* data, const std::string_view& v, int ofs, int len, CharSwap swap);
     [[nodiscard]] std::string getString3(const u8* data, int ofs, int len, bool jp);
     void setString3(u8* data, const std::string_view& v, int ofs, int len, bool jp, int padTo = 0,
         u8 padWith = 0xFF);
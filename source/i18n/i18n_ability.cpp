@@ -54,7 +54,7 @@ namespace i18n
         {
             return abilities[lang][size_t(val)];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::vector<std::string>& rawAbilities(pksm::Language lang)
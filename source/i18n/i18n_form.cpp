@@ -890,7 +890,7 @@ namespace i18n
                 return formss[lang][index];
             }
         }
-        return emptyString;
+        return missingString();
     }
 
     std::vector<std::string> forms(
@@ -55,7 +55,7 @@ namespace i18n
             return games[lang][u8(val)];
         }
 
-        return emptyString;
+        return missingString();
     }
 
     const std::vector<std::string>& rawGames(pksm::Language lang)
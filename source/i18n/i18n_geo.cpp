@@ -82,7 +82,7 @@ namespace i18n
                 return subregions[lang][country][v];
             }
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::string& country(pksm::Language lang, u8 v)
@@ -92,7 +92,7 @@ namespace i18n
         {
             return countries[lang][v];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::map<u8, std::string>& rawCountries(pksm::Language lang)
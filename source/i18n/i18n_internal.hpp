@@ -30,6 +30,7 @@
 #include "enums/Language.hpp"
 #include "utils/_map_macro.hpp"
 #include "utils/coretypes.h"
+#include "utils/counters.hpp"
 #include "utils/i18n.hpp"
 #include "utils/io.hpp"
 #include <atomic>
@@ -75,6 +76,7 @@ namespace i18n
 
     inline void checkInitialized(pksm::Language lang)
     {
+        pksm::counters::add(pksm::counters::Counter::I18nLookups);
         auto found = languages.find(lang);
         if (found == languages.end())
         {
@@ -93,6 +95,13 @@ namespace i18n
 #endif
     }
 
+    // What string lookups return when the value is out of range
+    inline const std::string& missingString()
+    {
+        pksm::counters::add(pksm::counters::Counter::I18nMisses);
+        return emptyString;
+    }
+
     std::string folder(pksm::Language lang);
 
     void load(pksm::Language lang, const std::string& name, std::vector<std::string>& array);
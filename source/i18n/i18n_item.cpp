@@ -108,7 +108,7 @@ namespace i18n
         {
             return items[lang][val];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::string& item1(pksm::Language lang, u8 val)
@@ -118,7 +118,7 @@ namespace i18n
         {
             return items1[lang][val];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::string& item2(pksm::Language lang, u8 val)
@@ -128,7 +128,7 @@ namespace i18n
         {
             return items2[lang][val];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::string& item3(pksm::Language lang, u16 val)
@@ -138,7 +138,7 @@ namespace i18n
         {
             return items3[lang][val];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::vector<std::string>& rawItems(pksm::Language lang)
@@ -134,7 +134,7 @@ namespace i18n
             case pksm::Generation::ONE:
                 break;
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::map<u16, std::string>& rawLocations(pksm::Language lang, pksm::Generation g)
@@ -53,7 +53,7 @@ namespace i18n
         {
             return moves[lang][size_t(val)];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::vector<std::string>& rawMoves(pksm::Language lang)
@@ -54,7 +54,7 @@ namespace i18n
         {
             return ribbons[lang][size_t(val)];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::vector<std::string>& rawRibbons(pksm::Language lang)
@@ -55,7 +55,7 @@ namespace i18n
             return speciess[lang][size_t(val)];
         }
 
-        return emptyString;
+        return missingString();
     }
 
     const std::vector<std::string>& rawSpecies(pksm::Language lang)
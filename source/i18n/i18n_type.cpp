@@ -54,7 +54,7 @@ namespace i18n
         {
             return types[lang][size_t(val)];
         }
-        return emptyString;
+        return missingString();
     }
 
     const std::vector<std::string>& rawTypes(pksm::Language lang)
@@ -25,6 +25,7 @@
  */
 
 #include "personal/personal.hpp"
+#include "personal/PersonalTable.hpp"
 #include "personal_bwb2w2.h"
 #include "personal_dppthgss.h"
 #include "personal_gsc.h"
@@ -36,10 +37,98 @@
 #include "personal_y.h"
 #include "utils/endian.hpp"
 
+namespace
+{
+    constexpr pksm::PersonalEntry decodeEntry17(u16, const u8* row)
+    {
+        return {row[0x0], row[0x1], row[0x2], row[0x3], row[0x4], row[0x5], pksm::Type{row[0x6]},
+            pksm::Type{row[0x7]}, row[0x8], row[0x9], row[0xA],
+            {pksm::Ability{row[0xB]}, pksm::Ability{row[0xC]}, pksm::Ability{row[0xD]}},
+            LittleEndian::convertTo<u16>(row + 0xE), row[0x10]};
+    }
+
+    // Generations 3 and 4 have the ??? type between Steel and Fire
+    constexpr pksm::Type oldType(u8 typeVal)
+    {
+        return pksm::Type{u8(typeVal > 8 ? typeVal - 1 : typeVal)};
+    }
+
+    template <size_t EntrySize, size_t Size>
+    consteval std::array<pksm::PersonalEntry, Size / EntrySize> makeEntries(
+        const u8 (&table)[Size], pksm::PersonalEntry (*decode)(u16, const u8*))
+    {
+        std::array<pksm::PersonalEntry, Size / EntrySize> ret{};
+        for (size_t i = 0; i < ret.size(); i++)
+        {
+            ret[i] = decode(i, table + i * EntrySize);
+        }
+        return ret;
+    }
+
+    template <size_t Count>
+    struct ColumnStorage
+    {
+        std::array<u8, Count> baseHP;
+        std::array<u8, Count> baseAtk;
+        std::array<u8, Count> baseDef;
+        std::array<u8, Count> baseSpe;
+        std::array<u8, Count> baseSpa;
+        std::array<u8, Count> baseSpd;
+        std::array<pksm::Type, Count> type1;
+        std::array<pksm::Type, Count> type2;
+        std::array<u8, Count> gender;
+        std::array<u8, Count> expType;
+
+        constexpr pksm::PersonalColumns view(void) const
+        {
+            return {baseHP, baseAtk, baseDef, baseSpe, baseSpa, baseSpd, type1, type2, gender,
+                expType};
+        }
+    };
+
+    template <size_t Count>
+    consteval ColumnStorage<Count> makeColumns(
+        const std::array<pksm::PersonalEntry, Count>& entries)
+    {
+        ColumnStorage<Count> ret{};
+        for (size_t i = 0; i < Count; i++)
+        {
+            ret.baseHP[i]  = entries[i].baseHP;
+            ret.baseAtk[i] = entries[i].baseAtk;
+            ret.baseDef[i] = entries[i].baseDef;
+            ret.baseSpe[i] = entries[i].baseSpe;
+            ret.baseSpa[i] = entries[i].baseSpa;
+            ret.baseSpd[i] = entries[i].baseSpd;
+            ret.type1[i]   = entries[i].type1;
+            ret.type2[i]   = entries[i].type2;
+            ret.gender[i]  = entries[i].gender;
+            ret.expType[i] = entries[i].expType;
+        }
+        return ret;
+    }
+}
+
 namespace pksm
 {
     namespace PersonalLGPE
     {
+        namespace
+        {
+            constexpr auto entries =
+                makeEntries<personal_lgpe_entrysize>(personal_lgpe, decodeEntry17);
+
+            constexpr auto columnStorage = makeColumns(entries);
+        }
+
+        const PersonalEntry& entry(u16 species)
+        {
+            return entries[species];
+        }
+        const PersonalColumns& columns(void)
+        {
+            static constexpr PersonalColumns ret = columnStorage.view();
+            return ret;
+        }
         u8 baseHP(u16 species)
         {
             return personal_lgpe[species * personal_lgpe_entrysize + 0x0];
@@ -101,6 +190,23 @@ namespace pksm
 
     namespace PersonalSMUSUM
     {
+        namespace
+        {
+            constexpr auto entries =
+                makeEntries<personal_smusum_entrysize>(personal_smusum, decodeEntry17);
+
+            constexpr auto columnStorage = makeColumns(entries);
+        }
+
+        const PersonalEntry& entry(u16 species)
+        {
+            return entries[species];
+        }
+        const PersonalColumns& columns(void)
+        {
+            static constexpr PersonalColumns ret = columnStorage.view();
+            return ret;
+        }
         u8 baseHP(u16 species)
         {
             return personal_smusum[species * personal_smusum_entrysize + 0x0];
@@ -162,6 +268,23 @@ namespace pksm
 
     namespace PersonalXYORAS
     {
+        namespace
+        {
+            constexpr auto entries =
+                makeEntries<personal_xyoras_entrysize>(personal_xyoras, decodeEntry17);
+
+            constexpr auto columnStorage = makeColumns(entries);
+        }
+
+        const PersonalEntry& entry(u16 species)
+        {
+            return entries[species];
+        }
+        const PersonalColumns& columns(void)
+        {
+            static constexpr PersonalColumns ret = columnStorage.view();
+            return ret;
+        }
         u8 baseHP(u16 species)
         {
             return personal_xyoras[species * personal_xyoras_entrysize + 0x0];
@@ -223,6 +346,23 @@ namespace pksm
 
     namespace PersonalBWB2W2
     {
+        namespace
+        {
+            constexpr auto entries =
+                makeEntries<personal_bwb2w2_entrysize>(personal_bwb2w2, decodeEntry17);
+
+            constexpr auto columnStorage = makeColumns(entries);
+        }
+
+        const PersonalEntry& entry(u16 species)
+        {
+            return entries[species];
+        }
+        const PersonalColumns& columns(void)
+        {
+            static constexpr PersonalColumns ret = columnStorage.view();
+            return ret;
+        }
         u8 baseHP(u16 species)
         {
             return personal_bwb2w2[species * personal_bwb2w2_entrysize + 0x0];
@@ -284,6 +424,31 @@ namespace pksm
 
     namespace PersonalDPPtHGSS
     {
+        namespace
+        {
+            constexpr PersonalEntry decodeEntry(u16 species, const u8* row)
+            {
+                return {row[0x0], row[0x1], row[0x2], row[0x3], row[0x4], row[0x5],
+                    oldType(row[0x6]), oldType(row[0x7]), row[0x8], row[0x9], row[0xA],
+                    {Ability{row[0xB]}, Ability{row[0xC]}, Ability::None},
+                    LittleEndian::convertTo<u16>(row + 0xD),
+                    u8(species == 201 ? 28 : row[0xF] == 0 ? 1 : row[0xF])};
+            }
+            constexpr auto entries =
+                makeEntries<personal_dppthgss_entrysize>(personal_dppthgss, decodeEntry);
+
+            constexpr auto columnStorage = makeColumns(entries);
+        }
+
+        const PersonalEntry& entry(u16 species)
+        {
+            return entries[species];
+        }
+        const PersonalColumns& columns(void)
+        {
+            static constexpr PersonalColumns ret = columnStorage.view();
+            return ret;
+        }
         u8 baseHP(u16 species)
         {
             return personal_dppthgss[species * personal_dppthgss_entrysize + 0x0];
@@ -370,6 +535,32 @@ namespace pksm
 
     namespace PersonalSWSH
     {
+        namespace
+        {
+            constexpr PersonalEntry decodeEntry(u16, const u8* row)
+            {
+                return {row[0x0], row[0x1], row[0x2], row[0x3], row[0x4], row[0x5], Type{row[0x6]},
+                    Type{row[0x7]}, row[0x8], row[0x9], row[0xA],
+                    {Ability{LittleEndian::convertTo<u16>(row + 0xC)},
+                        Ability{LittleEndian::convertTo<u16>(row + 0xE)},
+                        Ability{LittleEndian::convertTo<u16>(row + 0x10)}},
+                    LittleEndian::convertTo<u16>(row + 0x12), row[0xB]};
+            }
+            constexpr auto entries =
+                makeEntries<personal_swsh_entrysize>(personal_swsh, decodeEntry);
+
+            constexpr auto columnStorage = makeColumns(entries);
+        }
+
+        const PersonalEntry& entry(u16 species)
+        {
+            return entries[species];
+        }
+        const PersonalColumns& columns(void)
+        {
+            static constexpr PersonalColumns ret = columnStorage.view();
+            return ret;
+        }
         u8 baseHP(u16 species)
         {
             return personal_swsh[species * personal_swsh_entrysize + 0x0];
@@ -454,6 +645,30 @@ namespace pksm
 
     namespace PersonalRSFRLGE
     {
+        namespace
+        {
+            constexpr PersonalEntry decodeEntry(u16 species, const u8* row)
+            {
+                return {row[0x0], row[0x1], row[0x2], row[0x3], row[0x4], row[0x5],
+                    oldType(row[0x6]), oldType(row[0x7]), row[0x8], row[0x9], row[0xA],
+                    {Ability{row[0xB]}, Ability{row[0xC]}, Ability::None}, 0,
+                    u8(species == 201 ? 28 : species == 386 || species == 351 ? 4 : 1)};
+            }
+            constexpr auto entries =
+                makeEntries<personal_rsfrlge_entrysize>(personal_rsfrlge, decodeEntry);
+
+            constexpr auto columnStorage = makeColumns(entries);
+        }
+
+        const PersonalEntry& entry(u16 species)
+        {
+            return entries[species];
+        }
+        const PersonalColumns& columns(void)
+        {
+            static constexpr PersonalColumns ret = columnStorage.view();
+            return ret;
+        }
         u8 baseHP(u16 species)
         {
             return personal_rsfrlge[species * personal_rsfrlge_entrysize + 0x0];
@@ -663,4 +878,56 @@ namespace pksm
         }
     }
 
+
+    const PersonalEntry* personalEntry(Generation gen, u16 formSpecies)
+    {
+        switch (gen)
+        {
+            case Generation::THREE:
+                return &PersonalTable<Generation::THREE>::entry(formSpecies);
+            case Generation::FOUR:
+                return &PersonalTable<Generation::FOUR>::entry(formSpecies);
+            case Generation::FIVE:
+                return &PersonalTable<Generation::FIVE>::entry(formSpecies);
+            case Generation::SIX:
+                return &PersonalTable<Generation::SIX>::entry(formSpecies);
+            case Generation::SEVEN:
+                return &PersonalTable<Generation::SEVEN>::entry(formSpecies);
+            case Generation::LGPE:
+                return &PersonalTable<Generation::LGPE>::entry(formSpecies);
+            case Generation::EIGHT:
+                return &PersonalTable<Generation::EIGHT>::entry(formSpecies);
+            case Generation::ONE:
+            case Generation::TWO:
+            case Generation::UNUSED:
+                break;
+        }
+        return nullptr;
+    }
+
+    const PersonalColumns* personalColumns(Generation gen)
+    {
+        switch (gen)
+        {
+            case Generation::THREE:
+                return &PersonalTable<Generation::THREE>::columns();
+            case Generation::FOUR:
+                return &PersonalTable<Generation::FOUR>::columns();
+            case Generation::FIVE:
+                return &PersonalTable<Generation::FIVE>::columns();
+            case Generation::SIX:
+                return &PersonalTable<Generation::SIX>::columns();
+            case Generation::SEVEN:
+                return &PersonalTable<Generation::SEVEN>::columns();
+            case Generation::LGPE:
+                return &PersonalTable<Generation::LGPE>::columns();
+            case Generation::EIGHT:
+                return &PersonalTable<Generation::EIGHT>::columns();
+            case Generation::ONE:
+            case Generation::TWO:
+            case Generation::UNUSED:
+                break;
+        }
+        return nullptr;
+    }
 }
@@ -26,6 +26,8 @@
 
 #include "pkx/PB7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
+#include "utils/counters.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/utils.hpp"
@@ -63,6 +65,7 @@ namespace pksm
                     data + BOX_LENGTH, encryptionConstant());
             }
             pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            invalidatePersonal();
         }
     }
 
@@ -83,10 +86,16 @@ namespace pksm
 
     std::unique_ptr<PKX> PB7::clone(void) const
     {
+        counters::add(counters::Counter::PKXClones);
         return PKX::getPKM<Generation::LGPE>(
             const_cast<u8*>(data), isParty() ? PARTY_LENGTH : BOX_LENGTH);
     }
 
+    bool PB7::matchesFilter(const PKFilter& filter) const
+    {
+        return PKView<PB7>(*this).matches(filter);
+    }
+
     Generation PB7::generation(void) const
     {
         return Generation::LGPE;
@@ -94,11 +103,11 @@ namespace pksm
 
     u32 PB7::encryptionConstant(void) const
     {
-        return LittleEndian::convertTo<u32>(data);
+        return Fields::EncryptionConstant.read(data);
     }
     void PB7::encryptionConstant(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data, v);
+        Fields::EncryptionConstant.write(data, v);
     }
 
     u16 PB7::sanity(void) const
@@ -121,56 +130,57 @@ namespace pksm
 
     Species PB7::species(void) const
     {
-        return Species{LittleEndian::convertTo<u16>(data + 0x08)};
+        return Species{Fields::Species.read(data)};
     }
     void PB7::species(Species v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x08, u16(v));
+        Fields::Species.write(data, u16(v));
+        invalidatePersonal();
     }
 
     u16 PB7::heldItem(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0A);
+        return Fields::HeldItem.read(data);
     }
     void PB7::heldItem(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0A, v);
+        Fields::HeldItem.write(data, v);
     }
 
     u16 PB7::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0C);
+        return Fields::TID.read(data);
     }
     void PB7::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0C, v);
+        Fields::TID.write(data, v);
     }
 
     u16 PB7::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0E);
+        return Fields::SID.read(data);
     }
     void PB7::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0E, v);
+        Fields::SID.write(data, v);
     }
 
     u32 PB7::experience(void) const
     {
-        return LittleEndian::convertTo<u32>(data + 0x10);
+        return Fields::Experience.read(data);
     }
     void PB7::experience(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data + 0x10, v);
+        Fields::Experience.write(data, v);
     }
 
     Ability PB7::ability(void) const
     {
-        return Ability{data[0x14]};
+        return Ability{Fields::Ability.read(data)};
     }
     void PB7::ability(Ability v)
     {
-        data[0x14] = u8(v);
+        Fields::Ability.write(data, u8(v));
     }
 
     void PB7::setAbility(u8 v)
@@ -208,20 +218,20 @@ namespace pksm
 
     u32 PB7::PID(void) const
     {
-        return LittleEndian::convertTo<u32>(data + 0x18);
+        return Fields::PID.read(data);
     }
     void PB7::PID(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data + 0x18, v);
+        Fields::PID.write(data, v);
     }
 
     Nature PB7::nature(void) const
     {
-        return Nature{data[0x1C]};
+        return Nature{Fields::Nature.read(data)};
     }
     void PB7::nature(Nature v)
     {
-        data[0x1C] = u8(v);
+        Fields::Nature.write(data, u8(v));
     }
 
     bool PB7::fatefulEncounter(void) const
@@ -244,11 +254,12 @@ namespace pksm
 
     u16 PB7::alternativeForm(void) const
     {
-        return data[0x1D] >> 3;
+        return Fields::AlternativeForm.read(data);
     }
     void PB7::alternativeForm(u16 v)
     {
-        data[0x1D] = (data[0x1D] & 0x07) | (v << 3);
+        Fields::AlternativeForm.write(data, v);
+        invalidatePersonal();
     }
 
     u16 PB7::ev(Stat ev) const
@@ -316,11 +327,11 @@ namespace pksm
 
     Move PB7::move(u8 m) const
     {
-        return Move{LittleEndian::convertTo<u16>(data + 0x5A + m * 2)};
+        return Move{Fields::Move.at(m).read(data)};
     }
     void PB7::move(u8 m, Move v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x5A + m * 2, u16(v));
+        Fields::Move.at(m).write(data, u16(v));
     }
 
     u8 PB7::PP(u8 m) const
@@ -343,11 +354,11 @@ namespace pksm
 
     Move PB7::relearnMove(u8 m) const
     {
-        return Move{LittleEndian::convertTo<u16>(data + 0x6A + m * 2)};
+        return Move{Fields::RelearnMove.at(m).read(data)};
     }
     void PB7::relearnMove(u8 m, Move v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x6A + m * 2, u16(v));
+        Fields::RelearnMove.at(m).write(data, u16(v));
     }
 
     u8 PB7::iv(Stat stat) const
@@ -566,20 +577,20 @@ namespace pksm
 
     Ball PB7::ball(void) const
     {
-        return Ball{data[0xDC]};
+        return Ball{Fields::Ball.read(data)};
     }
     void PB7::ball(Ball v)
     {
-        data[0xDC] = u8(v);
+        Fields::Ball.write(data, u8(v));
     }
 
     u8 PB7::metLevel(void) const
     {
-        return data[0xDD] & ~0x80;
+        return Fields::MetLevel.read(data);
     }
     void PB7::metLevel(u8 v)
     {
-        data[0xDD] = (data[0xDD] & 0x80) | v;
+        Fields::MetLevel.write(data, v);
     }
 
     Gender PB7::otGender(void) const
@@ -613,11 +624,11 @@ namespace pksm
 
     Language PB7::language(void) const
     {
-        return Language(data[0xE3]);
+        return Language(Fields::Language.read(data));
     }
     void PB7::language(Language v)
     {
-        data[0xE3] = u8(v);
+        Fields::Language.write(data, u8(v));
     }
 
     u8 PB7::currentFriendship(void) const
@@ -705,11 +716,7 @@ namespace pksm
 
     u8 PB7::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-            ;
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PB7::level(u8 v)
@@ -752,8 +759,7 @@ namespace pksm
 
     u16 PB7::statImpl(Stat stat) const
     {
-        u16 calc;
-        u8 mult = 10, basestat = 0;
+        u8 basestat = 0;
 
         switch (stat)
         {
@@ -777,23 +783,27 @@ namespace pksm
                 break;
         }
 
-        if (stat == Stat::HP)
-            calc =
-                10 + ((2 * basestat) +
-                         ((((data[0xDE] >> hyperTrainLookup[u8(stat)]) & 1) == 1) ? 31 : iv(stat)) +
-                         ev(stat) / 4 + 100) *
-                         level() / 100;
-        else
-            calc =
-                5 + (2 * basestat +
-                        ((((data[0xDE] >> hyperTrainLookup[u8(stat)]) & 1) == 1) ? 31 : iv(stat)) +
-                        ev(stat) / 4) *
-                        level() / 100;
-        if (u8(nature()) / 5 + 1 == u8(stat))
-            mult++;
-        if (u8(nature()) % 5 + 1 == u8(stat))
-            mult--;
-        return calc * mult / 10 + awakened(stat);
+        return awakened(stat) + calcStat(
+            stat, basestat, hyperTrain(stat) ? 31 : iv(stat), ev(stat), level(), nature());
+    }
+
+    std::array<u16, 6> PB7::statsImpl(void) const
+    {
+        const PersonalEntry& personal = this->personal();
+        const u8 level                = levelFromExp(experience(), personal.expType);
+        const Nature nature           = this->nature();
+        const u8 baseStats[6]         = {personal.baseHP, personal.baseAtk, personal.baseDef,
+            personal.baseSpe, personal.baseSpa, personal.baseSpd};
+
+        std::array<u16, 6> ret;
+        for (size_t i = 0; i < ret.size(); i++)
+        {
+            const Stat stat = Stat(i);
+            const u8 iv     = hyperTrain(stat) ? 31 : this->iv(stat);
+            const u16 calc  = calcStat(stat, baseStats[i], iv, ev(stat), level, nature);
+            ret[i]          = calc + awakened(stat);
+        }
+        return ret;
     }
 
     int PB7::partyCurrHP(void) const
@@ -866,19 +876,22 @@ namespace pksm
 
     u16 PB7::CP() const
     {
-        int base  = stat(Stat::HP) + 10 + level(); // HP
+        const std::array<u16, 6> stats = this->stats();
+        const u8 level                 = this->level();
+
+        int base  = stats[size_t(Stat::HP)] + 10 + level; // HP
         int mult  = ((currentFriendship() / 255.0f / 10.0f) + 1.0f) * 100.0f;
         int awake = awakened(Stat::HP);
 
         for (int i = 1; i < 6; i++)
         {
-            base += stat(Stat(i)) * mult / 100;
+            base += stats[i] * mult / 100;
             awake += awakened(Stat(i));
         }
 
-        base = u16((float)(base * 6 * level()) / 100.0f);
+        base = u16((float)(base * 6 * level) / 100.0f);
 
-        double modifier = level() / 100.0 + 2.0;
+        double modifier = level / 100.0 + 2.0;
         awake           = u16(modifier) * awake;
         return std::min(10000, base + awake);
     }
@@ -905,14 +918,13 @@ namespace pksm
 
     void PB7::updatePartyData()
     {
-        static constexpr Stat stats[] = {
-            Stat::HP, Stat::ATK, Stat::DEF, Stat::SPD, Stat::SPATK, Stat::SPDEF};
-        for (size_t i = 0; i < 6; i++)
+        const std::array<u16, 6> stats = this->stats();
+        for (size_t i = 0; i < stats.size(); i++)
         {
-            partyStat(stats[i], stat(stats[i]));
+            partyStat(Stat(i), stats[i]);
         }
         partyLevel(level());
-        partyCurrHP(stat(Stat::HP));
+        partyCurrHP(stats[size_t(Stat::HP)]);
         partyCP(CP());
     }
 
@@ -32,8 +32,10 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/ValueConverter.hpp"
+#include "utils/counters.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/flagUtil.hpp"
@@ -49,7 +51,7 @@ namespace pksm
     {
         this->japanese = japanese;
         lang           = japanese ? Language::JPN : Language::ENG;
-        shiftedData    = data + 3;
+        shiftedData    = data + Fields::RecordStart;
     }
 
     std::unique_ptr<PK2> PK1::convertToG2(Sav&) const
@@ -275,17 +277,23 @@ namespace pksm
 
     std::unique_ptr<PKX> PK1::clone() const
     {
+        counters::add(counters::Counter::PKXClones);
         return PKX::getPKM<Generation::ONE>(
             const_cast<u8*>(data), japanese ? JP_LENGTH_WITH_NAMES : INT_LENGTH_WITH_NAMES);
     }
 
+    bool PK1::matchesFilter(const PKFilter& filter) const
+    {
+        return PKView<PK1>(*this).matches(filter);
+    }
+
     u16 PK1::TID() const
     {
-        return BigEndian::convertTo<u16>(shiftedData + 12);
+        return Fields::TID.read(shiftedData);
     }
     void PK1::TID(u16 v)
     {
-        BigEndian::convertFrom<u16>(shiftedData + 12, v);
+        Fields::TID.write(shiftedData, v);
     }
     std::string PK1::nickname() const
     {
@@ -325,12 +333,12 @@ namespace pksm
 
     u8 PK1::speciesID1() const
     {
-        return shiftedData[0];
+        return Fields::SpeciesID1.read(shiftedData);
     }
     void PK1::speciesID1(u8 v)
     {
-        data[1]        = v;
-        shiftedData[0] = v;
+        data[1] = v;
+        Fields::SpeciesID1.write(shiftedData, v);
         writeG1Types();
 
         // do this now rather than never
@@ -350,22 +358,20 @@ namespace pksm
     // importing
     u8 PK1::catchRate() const
     {
-        return shiftedData[7];
+        return Fields::CatchRate.read(shiftedData);
     }
     void PK1::catchRate(u8 v)
     {
-        shiftedData[7] = v;
+        Fields::CatchRate.write(shiftedData, v);
     }
     // experience is actually 3 bytes
     u32 PK1::experience() const
     {
-        return BigEndian::convertTo<u32>(shiftedData + 14) >> 8;
+        return Fields::Experience.read(shiftedData);
     }
     void PK1::experience(u32 v)
     {
-        shiftedData[14] = v >> 16;
-        shiftedData[15] = (v >> 8) & 0x00FF;
-        shiftedData[16] = v & 0x0000FF;
+        Fields::Experience.write(shiftedData, v);
     }
     u16 PK1::ev(Stat ev) const
     {
@@ -382,11 +388,11 @@ namespace pksm
 
     Move PK1::move(u8 move) const
     {
-        return Move{shiftedData[8 + move]};
+        return Move{Fields::Move.at(move).read(shiftedData)};
     }
     void PK1::move(u8 move, Move v)
     {
-        shiftedData[8 + move] = u8(v);
+        Fields::Move.at(move).write(shiftedData, u8(v));
     }
     u8 PK1::PP(u8 move) const
     {
@@ -522,11 +528,7 @@ namespace pksm
 
     u8 PK1::level() const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-            ;
-        return i;
+        return levelFromExp(experience(), expType());
     }
     void PK1::level(u8 v)
     {
@@ -580,11 +582,24 @@ namespace pksm
             default:
                 base = 0;
         }
-        u16 EV  = u16(std::min(255, int(std::ceil(std::sqrt(ev(stat))))) >> 2);
-        u16 mid = u16(((2 * (base + iv(stat)) + EV) * level() / 100) + 5);
-        if (stat == Stat::HP)
-            return mid + 5 + level();
-        return mid;
+        return calcStatGB(stat, base, iv(stat), ev(stat), level());
+    }
+
+    std::array<u16, 6> PK1::statsImpl() const
+    {
+        const u8 species      = u8(this->species());
+        const u8 level        = levelFromExp(experience(), PersonalRGBY::expType(species));
+        const u8 baseStats[6] = {PersonalRGBY::baseHP(species), PersonalRGBY::baseAtk(species),
+            PersonalRGBY::baseDef(species), PersonalRGBY::baseSpe(species),
+            PersonalRGBY::baseSpad(species), PersonalRGBY::baseSpad(species)};
+
+        std::array<u16, 6> ret;
+        for (size_t i = 0; i < ret.size(); i++)
+        {
+            const Stat stat = Stat(i);
+            ret[i]          = calcStatGB(stat, baseStats[i], iv(stat), ev(stat), level);
+        }
+        return ret;
     }
 
     int PK1::partyCurrHP() const
@@ -632,10 +647,11 @@ namespace pksm
     }
     void PK1::updatePartyData()
     {
+        const std::array<u16, 6> stats = this->stats();
         partyLevel(level());
         for (u8 pstat = u8(Stat::HP); pstat != u8(Stat::SPDEF); pstat++)
         {
-            partyStat(static_cast<Stat>(pstat), stat(static_cast<Stat>(pstat)));
+            partyStat(static_cast<Stat>(pstat), stats[pstat]);
         }
     }
 
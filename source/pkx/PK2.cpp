@@ -32,8 +32,10 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/ValueConverter.hpp"
+#include "utils/counters.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/flagUtil.hpp"
@@ -49,7 +51,7 @@ namespace pksm
     {
         this->japanese = japanese;
         lang           = japanese ? Language::JPN : Language::ENG;
-        shiftedData    = data + 3;
+        shiftedData    = data + Fields::RecordStart;
     }
 
     std::unique_ptr<PK1> PK2::convertToG1(Sav& save) const
@@ -302,10 +304,16 @@ namespace pksm
 
     std::unique_ptr<PKX> PK2::clone() const
     {
+        counters::add(counters::Counter::PKXClones);
         return PKX::getPKM<Generation::TWO>(
             const_cast<u8*>(data), japanese ? JP_LENGTH_WITH_NAMES : INT_LENGTH_WITH_NAMES);
     }
 
+    bool PK2::matchesFilter(const PKFilter& filter) const
+    {
+        return PKView<PK2>(*this).matches(filter);
+    }
+
     u8 PK2::currentFriendship() const
     {
         return otFriendship();
@@ -317,11 +325,11 @@ namespace pksm
 
     u16 PK2::TID() const
     {
-        return BigEndian::convertTo<u16>(shiftedData + 6);
+        return Fields::TID.read(shiftedData);
     }
     void PK2::TID(u16 v)
     {
-        BigEndian::convertFrom<u16>(shiftedData + 6, v);
+        Fields::TID.write(shiftedData, v);
     }
 
     std::string PK2::nickname() const
@@ -373,11 +381,11 @@ namespace pksm
 
     Species PK2::species() const
     {
-        return Species{shiftedData[0]};
+        return Species{Fields::Species.read(shiftedData)};
     }
     void PK2::species(Species v)
     {
-        shiftedData[0] = u8(v);
+        Fields::Species.write(shiftedData, u8(v));
         if (!egg())
             data[1] = u8(v);
 
@@ -388,15 +396,15 @@ namespace pksm
 
     u8 PK2::heldItem2() const
     {
-        return shiftedData[1];
+        return Fields::HeldItem2.read(shiftedData);
     }
     void PK2::heldItem2(u8 v)
     {
-        shiftedData[1] = v;
+        Fields::HeldItem2.write(shiftedData, v);
     }
     u16 PK2::heldItem() const
     {
-        return ItemConverter::g2ToNational(shiftedData[1]);
+        return ItemConverter::g2ToNational(heldItem2());
     }
     void PK2::heldItem(u16 v)
     {
@@ -415,13 +423,11 @@ namespace pksm
     }
     u32 PK2::experience() const
     {
-        return BigEndian::convertTo<u32>(shiftedData + 8) >> 8;
+        return Fields::Experience.read(shiftedData);
     }
     void PK2::experience(u32 v)
     {
-        shiftedData[8]  = v >> 16;
-        shiftedData[9]  = (v >> 8) & 0x00FF;
-        shiftedData[10] = v & 0x0000FF;
+        Fields::Experience.write(shiftedData, v);
 
         shiftedData[31] = level();
     }
@@ -448,11 +454,11 @@ namespace pksm
 
     Move PK2::move(u8 move) const
     {
-        return Move{shiftedData[2 + move]};
+        return Move{Fields::Move.at(move).read(shiftedData)};
     }
     void PK2::move(u8 move, Move v)
     {
-        shiftedData[2 + move] = u8(v);
+        Fields::Move.at(move).write(shiftedData, u8(v));
     }
 
     u8 PK2::PP(u8 move) const
@@ -691,11 +697,7 @@ namespace pksm
 
     u8 PK2::level() const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-            ;
-        return i;
+        return levelFromExp(experience(), expType());
     }
     void PK2::level(u8 v)
     {
@@ -746,11 +748,24 @@ namespace pksm
             default:
                 base = 0;
         }
-        u16 EV  = u16(std::min(255, int(std::ceil(std::sqrt(ev(stat))))) >> 2);
-        u16 mid = u16(((2 * (base + iv(stat)) + EV) * level() / 100) + 5);
-        if (stat == Stat::HP)
-            return mid + 5 + level();
-        return mid;
+        return calcStatGB(stat, base, iv(stat), ev(stat), level());
+    }
+
+    std::array<u16, 6> PK2::statsImpl() const
+    {
+        const u8 species      = u8(this->species());
+        const u8 level        = levelFromExp(experience(), PersonalGSC::expType(species));
+        const u8 baseStats[6] = {PersonalGSC::baseHP(species), PersonalGSC::baseAtk(species),
+            PersonalGSC::baseDef(species), PersonalGSC::baseSpe(species),
+            PersonalGSC::baseSpa(species), PersonalGSC::baseSpd(species)};
+
+        std::array<u16, 6> ret;
+        for (size_t i = 0; i < ret.size(); i++)
+        {
+            const Stat stat = Stat(i);
+            ret[i]          = calcStatGB(stat, baseStats[i], iv(stat), ev(stat), level);
+        }
+        return ret;
     }
 
     int PK2::partyCurrHP() const
@@ -782,10 +797,11 @@ namespace pksm
     }
     void PK2::updatePartyData()
     {
+        const std::array<u16, 6> stats = this->stats();
         partyLevel(level());
         for (u8 pstat = u8(Stat::HP); pstat <= u8(Stat::SPDEF); pstat++)
         {
-            partyStat(static_cast<Stat>(pstat), stat(static_cast<Stat>(pstat)));
+            partyStat(static_cast<Stat>(pstat), stats[pstat]);
         }
     }
 }
@@ -32,8 +32,10 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
 #include "utils/ValueConverter.hpp"
+#include "utils/counters.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/flagUtil.hpp"
@@ -42,43 +44,22 @@
 #include "utils/utils.hpp"
 #include <algorithm>
 
-#define RIBBON_ABSENT 0xFFFFFFFF
-
 namespace
 {
-    std::pair<size_t, size_t> OFFSET_OF(pksm::Ribbon rib)
-    {
-        switch (rib)
-        {
-            case pksm::Ribbon::ChampionG3Hoenn:
-                return {0x4D, 7};
-            case pksm::Ribbon::Winning:
-                return {0x4E, 0};
-            case pksm::Ribbon::Victory:
-                return {0x4E, 1};
-            case pksm::Ribbon::Artist:
-                return {0x4E, 2};
-            case pksm::Ribbon::Effort:
-                return {0x4E, 3};
-            case pksm::Ribbon::ChampionBattle:
-                return {0x4E, 4};
-            case pksm::Ribbon::ChampionRegional:
-                return {0x4E, 5};
-            case pksm::Ribbon::ChampionNational:
-                return {0x4E, 6};
-            case pksm::Ribbon::Country:
-                return {0x4E, 7};
-            case pksm::Ribbon::National:
-                return {0x4F, 0};
-            case pksm::Ribbon::Earth:
-                return {0x4F, 1};
-            case pksm::Ribbon::World:
-                return {0x4F, 2};
-
-            default:
-                return {RIBBON_ABSENT, 0};
-        }
-    }
+    constexpr pksm::RibbonTable RIBBONS = pksm::makeRibbonTable({
+        {pksm::Ribbon::ChampionG3Hoenn, {0x4D, 7}},
+        {pksm::Ribbon::Winning, {0x4E, 0}},
+        {pksm::Ribbon::Victory, {0x4E, 1}},
+        {pksm::Ribbon::Artist, {0x4E, 2}},
+        {pksm::Ribbon::Effort, {0x4E, 3}},
+        {pksm::Ribbon::ChampionBattle, {0x4E, 4}},
+        {pksm::Ribbon::ChampionRegional, {0x4E, 5}},
+        {pksm::Ribbon::ChampionNational, {0x4E, 6}},
+        {pksm::Ribbon::Country, {0x4E, 7}},
+        {pksm::Ribbon::National, {0x4F, 0}},
+        {pksm::Ribbon::Earth, {0x4F, 1}},
+        {pksm::Ribbon::World, {0x4F, 2}},
+    });
 }
 
 namespace pksm
@@ -109,6 +90,7 @@ namespace pksm
             u8 sv = PID() % 24;
             crypt();
             pksm::crypto::pkm::blockShuffle<BlockDataLength>(data + BlockShuffleStart, sv);
+            invalidatePersonal();
         }
     }
 
@@ -166,6 +148,7 @@ namespace pksm
 
     std::unique_ptr<PKX> PK3::clone(void) const
     {
+        counters::add(counters::Counter::PKXClones);
         // Can't use normal data constructor because of checksum encryption checks
         std::unique_ptr<PK3> ret =
             PKX::getPKM<Generation::THREE>(nullptr, isParty() ? PARTY_LENGTH : BOX_LENGTH);
@@ -173,6 +156,11 @@ namespace pksm
         return ret;
     }
 
+    bool PK3::matchesFilter(const PKFilter& filter) const
+    {
+        return PKView<PK3>(*this).matches(filter);
+    }
+
     Generation PK3::generation(void) const
     {
         return Generation::THREE;
@@ -204,29 +192,29 @@ namespace pksm
 
     u32 PK3::PID(void) const
     {
-        return LittleEndian::convertTo<u32>(data);
+        return Fields::PID.read(data);
     }
     void PK3::PID(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data, v);
+        Fields::PID.write(data, v);
     }
 
     u16 PK3::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x04);
+        return Fields::TID.read(data);
     }
     void PK3::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x04, v);
+        Fields::TID.write(data, v);
     }
 
     u16 PK3::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x06);
+        return Fields::SID.read(data);
     }
     void PK3::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x06, v);
+        Fields::SID.write(data, v);
     }
 
     std::string PK3::nickname(void) const
@@ -240,11 +228,11 @@ namespace pksm
 
     Language PK3::language(void) const
     {
-        return Language(data[0x12]);
+        return Language(Fields::Language.read(data));
     }
     void PK3::language(Language v)
     {
-        data[0x12] = u8(v);
+        Fields::Language.write(data, u8(v));
     }
 
     bool PK3::flagIsBadEgg(void) const
@@ -312,11 +300,12 @@ namespace pksm
 
     u16 PK3::speciesID3(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x20);
+        return Fields::SpeciesID3.read(data);
     }
     void PK3::speciesID3(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x20, v);
+        Fields::SpeciesID3.write(data, v);
+        invalidatePersonal();
     }
 
     Species PK3::species(void) const
@@ -331,11 +320,11 @@ namespace pksm
 
     u16 PK3::heldItem3(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x22);
+        return Fields::HeldItem3.read(data);
     }
     void PK3::heldItem3(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x22, v);
+        Fields::HeldItem3.write(data, v);
     }
 
     u16 PK3::heldItem(void) const
@@ -361,11 +350,11 @@ namespace pksm
 
     u32 PK3::experience(void) const
     {
-        return LittleEndian::convertTo<u32>(data + 0x24);
+        return Fields::Experience.read(data);
     }
     void PK3::experience(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data + 0x24, v);
+        Fields::Experience.write(data, v);
     }
 
     u8 PK3::PPUp(u8 move) const
@@ -388,11 +377,11 @@ namespace pksm
 
     Move PK3::move(u8 move) const
     {
-        return Move{LittleEndian::convertTo<u16>(data + 0x2C + move * 2)};
+        return Move{Fields::Move.at(move).read(data)};
     }
     void PK3::move(u8 move, Move v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x2C + move * 2, u16(v));
+        Fields::Move.at(move).write(data, u16(v));
     }
 
     u8 PK3::PP(u8 move) const
@@ -460,12 +449,11 @@ namespace pksm
 
     u8 PK3::metLevel(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x46) & 0x7F;
+        return Fields::MetLevel.read(data);
     }
     void PK3::metLevel(u8 v)
     {
-        LittleEndian::convertFrom<u16>(
-            data + 0x46, u16((LittleEndian::convertTo<u16>(data + 0x46) & ~0x7F) | v));
+        Fields::MetLevel.write(data, v);
     }
 
     GameVersion PK3::version(void) const
@@ -480,12 +468,11 @@ namespace pksm
 
     Ball PK3::ball(void) const
     {
-        return Ball{u8((LittleEndian::convertTo<u16>(data + 0x46) >> 11) & 0xF)};
+        return Ball{u8(Fields::Ball.read(data))};
     }
     void PK3::ball(Ball v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x46,
-            u16((LittleEndian::convertTo<u16>(data + 0x46) & ~0x7800) | ((u16(v) & 0xF) << 11)));
+        Fields::Ball.write(data, u16(v));
     }
 
     Gender PK3::otGender(void) const
@@ -540,23 +527,23 @@ namespace pksm
 
     bool PK3::hasRibbon(Ribbon ribbon) const
     {
-        return OFFSET_OF(ribbon).first != RIBBON_ABSENT;
+        return ribbonBit(RIBBONS, ribbon).present();
     }
     bool PK3::ribbon(Ribbon ribbon) const
     {
-        auto offset = OFFSET_OF(ribbon);
-        if (offset.first != RIBBON_ABSENT)
+        const RibbonBit bit = ribbonBit(RIBBONS, ribbon);
+        if (bit.present())
         {
-            return FlagUtil::getFlag(data, offset.first, offset.second);
+            return FlagUtil::getFlag(data, bit.offset, bit.bit);
         }
         return false;
     }
     void PK3::ribbon(Ribbon ribbon, bool v)
     {
-        auto offset = OFFSET_OF(ribbon);
-        if (offset.first != RIBBON_ABSENT)
+        const RibbonBit bit = ribbonBit(RIBBONS, ribbon);
+        if (bit.present())
         {
-            FlagUtil::setFlag(data, offset.first, offset.second, v);
+            FlagUtil::setFlag(data, bit.offset, bit.bit, v);
         }
     }
     u8 PK3::contestRibbonCount(u8 contest) const
@@ -905,11 +892,7 @@ namespace pksm
 
     u8 PK3::level() const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-            ;
-        return i;
+        return levelFromExp(experience(), expType());
     }
     void PK3::level(u8 v)
     {
@@ -1060,8 +1043,7 @@ namespace pksm
 
     u16 PK3::statImpl(Stat stat) const
     {
-        u16 calc;
-        u8 mult = 10, basestat = 0;
+        u8 basestat = 0;
 
         switch (stat)
         {
@@ -1085,27 +1067,34 @@ namespace pksm
                 break;
         }
 
-        if (stat == Stat::HP)
-            calc = 10 + (2 * basestat + iv(stat) + ev(stat) / 4 + 100) * level() / 100;
-        else
-            calc = 5 + (2 * basestat + iv(stat) + ev(stat) / 4) * level() / 100;
+        return calcStat(stat, basestat, iv(stat), ev(stat), level(), nature());
+    }
 
-        if (u8(nature()) / 5 + 1 == u8(stat))
-            mult++;
-        if (u8(nature()) % 5 + 1 == u8(stat))
-            mult--;
-        return calc * mult / 10;
+    std::array<u16, 6> PK3::statsImpl(void) const
+    {
+        const PersonalEntry& personal = this->personal();
+        const u8 level                = levelFromExp(experience(), personal.expType);
+        const Nature nature           = this->nature();
+        const u8 baseStats[6]         = {personal.baseHP, personal.baseAtk, personal.baseDef,
+            personal.baseSpe, personal.baseSpa, personal.baseSpd};
+
+        std::array<u16, 6> ret;
+        for (size_t i = 0; i < ret.size(); i++)
+        {
+            const Stat stat = Stat(i);
+            ret[i]          = calcStat(stat, baseStats[i], iv(stat), ev(stat), level, nature);
+        }
+        return ret;
     }
 
     void PK3::updatePartyData()
     {
-        static constexpr Stat stats[] = {
-            Stat::HP, Stat::ATK, Stat::DEF, Stat::SPD, Stat::SPATK, Stat::SPDEF};
-        for (size_t i = 0; i < 6; i++)
+        const std::array<u16, 6> stats = this->stats();
+        for (size_t i = 0; i < stats.size(); i++)
         {
-            partyStat(stats[i], stat(stats[i]));
+            partyStat(Stat(i), stats[i]);
         }
         partyLevel(level());
-        partyCurrHP(stat(Stat::HP));
+        partyCurrHP(stats[size_t(Stat::HP)]);
     }
 }
@@ -32,7 +32,9 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
+#include "utils/counters.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/flagUtil.hpp"
@@ -41,179 +43,90 @@
 #include "utils/utils.hpp"
 #include <algorithm>
 
-#define RIBBON_ABSENT 0xFFFFFFFF
-
 namespace
 {
-    std::pair<size_t, size_t> OFFSET_OF(pksm::Ribbon rib)
-    {
-        switch (rib)
-        {
-            case pksm::Ribbon::ChampionSinnoh:
-                return {0x24, 0};
-            case pksm::Ribbon::Ability:
-                return {0x24, 1};
-            case pksm::Ribbon::AbilityGreat:
-                return {0x24, 2};
-            case pksm::Ribbon::AbilityDouble:
-                return {0x24, 3};
-            case pksm::Ribbon::AbilityMulti:
-                return {0x24, 4};
-            case pksm::Ribbon::AbilityPair:
-                return {0x24, 5};
-            case pksm::Ribbon::AbilityWorld:
-                return {0x24, 6};
-            case pksm::Ribbon::Alert:
-                return {0x24, 7};
-            case pksm::Ribbon::Shock:
-                return {0x25, 0};
-            case pksm::Ribbon::Downcast:
-                return {0x25, 1};
-            case pksm::Ribbon::Careless:
-                return {0x25, 2};
-            case pksm::Ribbon::Relax:
-                return {0x25, 3};
-            case pksm::Ribbon::Snooze:
-                return {0x25, 4};
-            case pksm::Ribbon::Smile:
-                return {0x25, 5};
-            case pksm::Ribbon::Gorgeous:
-                return {0x25, 6};
-            case pksm::Ribbon::Royal:
-                return {0x25, 7};
-            case pksm::Ribbon::GorgeousRoyal:
-                return {0x26, 0};
-            case pksm::Ribbon::Footprint:
-                return {0x26, 1};
-            case pksm::Ribbon::Record:
-                return {0x26, 2};
-            case pksm::Ribbon::Event:
-                return {0x26, 3};
-            case pksm::Ribbon::Legend:
-                return {0x26, 4};
-            case pksm::Ribbon::ChampionWorld:
-                return {0x26, 5};
-            case pksm::Ribbon::Birthday:
-                return {0x26, 6};
-            case pksm::Ribbon::Special:
-                return {0x26, 7};
-            case pksm::Ribbon::Souvenir:
-                return {0x27, 0};
-            case pksm::Ribbon::Wishing:
-                return {0x27, 1};
-            case pksm::Ribbon::Classic:
-                return {0x27, 2};
-            case pksm::Ribbon::Premier:
-                return {0x27, 3};
-            case pksm::Ribbon::G3Cool:
-                return {0X3C, 0};
-            case pksm::Ribbon::G3CoolSuper:
-                return {0X3C, 1};
-            case pksm::Ribbon::G3CoolHyper:
-                return {0X3C, 2};
-            case pksm::Ribbon::G3CoolMaster:
-                return {0X3C, 3};
-            case pksm::Ribbon::G3Beauty:
-                return {0X3C, 4};
-            case pksm::Ribbon::G3BeautySuper:
-                return {0X3C, 5};
-            case pksm::Ribbon::G3BeautyHyper:
-                return {0X3C, 6};
-            case pksm::Ribbon::G3BeautyMaster:
-                return {0X3C, 7};
-            case pksm::Ribbon::G3Cute:
-                return {0x3D, 0};
-            case pksm::Ribbon::G3CuteSuper:
-                return {0x3D, 1};
-            case pksm::Ribbon::G3CuteHyper:
-                return {0x3D, 2};
-            case pksm::Ribbon::G3CuteMaster:
-                return {0x3D, 3};
-            case pksm::Ribbon::G3Smart:
-                return {0x3D, 4};
-            case pksm::Ribbon::G3SmartSuper:
-                return {0x3D, 5};
-            case pksm::Ribbon::G3SmartHyper:
-                return {0x3D, 6};
-            case pksm::Ribbon::G3SmartMaster:
-                return {0x3D, 7};
-            case pksm::Ribbon::G3Tough:
-                return {0x3E, 0};
-            case pksm::Ribbon::G3ToughSuper:
-                return {0x3E, 1};
-            case pksm::Ribbon::G3ToughHyper:
-                return {0x3E, 2};
-            case pksm::Ribbon::G3ToughMaster:
-                return {0x3E, 3};
-            case pksm::Ribbon::ChampionG3Hoenn:
-                return {0x3E, 4};
-            case pksm::Ribbon::Winning:
-                return {0x3E, 5};
-            case pksm::Ribbon::Victory:
-                return {0x3E, 6};
-            case pksm::Ribbon::Artist:
-                return {0x3E, 7};
-            case pksm::Ribbon::Effort:
-                return {0x3F, 0};
-            case pksm::Ribbon::ChampionBattle:
-                return {0x3F, 1};
-            case pksm::Ribbon::ChampionRegional:
-                return {0x3F, 2};
-            case pksm::Ribbon::ChampionNational:
-                return {0x3F, 3};
-            case pksm::Ribbon::Country:
-                return {0x3F, 4};
-            case pksm::Ribbon::National:
-                return {0x3F, 5};
-            case pksm::Ribbon::Earth:
-                return {0x3F, 6};
-            case pksm::Ribbon::World:
-                return {0x3F, 7};
-            case pksm::Ribbon::G4Cool:
-                return {0x60, 0};
-            case pksm::Ribbon::G4CoolGreat:
-                return {0x60, 1};
-            case pksm::Ribbon::G4CoolUltra:
-                return {0x60, 2};
-            case pksm::Ribbon::G4CoolMaster:
-                return {0x60, 3};
-            case pksm::Ribbon::G4Beauty:
-                return {0x60, 4};
-            case pksm::Ribbon::G4BeautyGreat:
-                return {0x60, 5};
-            case pksm::Ribbon::G4BeautyUltra:
-                return {0x60, 6};
-            case pksm::Ribbon::G4BeautyMaster:
-                return {0x60, 7};
-            case pksm::Ribbon::G4Cute:
-                return {0x61, 0};
-            case pksm::Ribbon::G4CuteGreat:
-                return {0x61, 1};
-            case pksm::Ribbon::G4CuteUltra:
-                return {0x61, 2};
-            case pksm::Ribbon::G4CuteMaster:
-                return {0x61, 3};
-            case pksm::Ribbon::G4Smart:
-                return {0x61, 4};
-            case pksm::Ribbon::G4SmartGreat:
-                return {0x61, 5};
-            case pksm::Ribbon::G4SmartUltra:
-                return {0x61, 6};
-            case pksm::Ribbon::G4SmartMaster:
-                return {0x61, 7};
-            case pksm::Ribbon::G4Tough:
-                return {0x62, 0};
-            case pksm::Ribbon::G4ToughGreat:
-                return {0x62, 1};
-            case pksm::Ribbon::G4ToughUltra:
-                return {0x62, 2};
-            case pksm::Ribbon::G4ToughMaster:
-                return {0x62, 3};
-
-            default:
-                return {RIBBON_ABSENT, 0};
-        }
-    }
+    constexpr pksm::RibbonTable RIBBONS = pksm::makeRibbonTable({
+        {pksm::Ribbon::ChampionSinnoh, {0x24, 0}},
+        {pksm::Ribbon::Ability, {0x24, 1}},
+        {pksm::Ribbon::AbilityGreat, {0x24, 2}},
+        {pksm::Ribbon::AbilityDouble, {0x24, 3}},
+        {pksm::Ribbon::AbilityMulti, {0x24, 4}},
+        {pksm::Ribbon::AbilityPair, {0x24, 5}},
+        {pksm::Ribbon::AbilityWorld, {0x24, 6}},
+        {pksm::Ribbon::Alert, {0x24, 7}},
+        {pksm::Ribbon::Shock, {0x25, 0}},
+        {pksm::Ribbon::Downcast, {0x25, 1}},
+        {pksm::Ribbon::Careless, {0x25, 2}},
+        {pksm::Ribbon::Relax, {0x25, 3}},
+        {pksm::Ribbon::Snooze, {0x25, 4}},
+        {pksm::Ribbon::Smile, {0x25, 5}},
+        {pksm::Ribbon::Gorgeous, {0x25, 6}},
+        {pksm::Ribbon::Royal, {0x25, 7}},
+        {pksm::Ribbon::GorgeousRoyal, {0x26, 0}},
+        {pksm::Ribbon::Footprint, {0x26, 1}},
+        {pksm::Ribbon::Record, {0x26, 2}},
+        {pksm::Ribbon::Event, {0x26, 3}},
+        {pksm::Ribbon::Legend, {0x26, 4}},
+        {pksm::Ribbon::ChampionWorld, {0x26, 5}},
+        {pksm::Ribbon::Birthday, {0x26, 6}},
+        {pksm::Ribbon::Special, {0x26, 7}},
+        {pksm::Ribbon::Souvenir, {0x27, 0}},
+        {pksm::Ribbon::Wishing, {0x27, 1}},
+        {pksm::Ribbon::Classic, {0x27, 2}},
+        {pksm::Ribbon::Premier, {0x27, 3}},
+        {pksm::Ribbon::G3Cool, {0x3C, 0}},
+        {pksm::Ribbon::G3CoolSuper, {0x3C, 1}},
+        {pksm::Ribbon::G3CoolHyper, {0x3C, 2}},
+        {pksm::Ribbon::G3CoolMaster, {0x3C, 3}},
+        {pksm::Ribbon::G3Beauty, {0x3C, 4}},
+        {pksm::Ribbon::G3BeautySuper, {0x3C, 5}},
+        {pksm::Ribbon::G3BeautyHyper, {0x3C, 6}},
+        {pksm::Ribbon::G3BeautyMaster, {0x3C, 7}},
+        {pksm::Ribbon::G3Cute, {0x3D, 0}},
+        {pksm::Ribbon::G3CuteSuper, {0x3D, 1}},
+        {pksm::Ribbon::G3CuteHyper, {0x3D, 2}},
+        {pksm::Ribbon::G3CuteMaster, {0x3D, 3}},
+        {pksm::Ribbon::G3Smart, {0x3D, 4}},
+        {pksm::Ribbon::G3SmartSuper, {0x3D, 5}},
+        {pksm::Ribbon::G3SmartHyper, {0x3D, 6}},
+        {pksm::Ribbon::G3SmartMaster, {0x3D, 7}},
+        {pksm::Ribbon::G3Tough, {0x3E, 0}},
+        {pksm::Ribbon::G3ToughSuper, {0x3E, 1}},
+        {pksm::Ribbon::G3ToughHyper, {0x3E, 2}},
+        {pksm::Ribbon::G3ToughMaster, {0x3E, 3}},
+        {pksm::Ribbon::ChampionG3Hoenn, {0x3E, 4}},
+        {pksm::Ribbon::Winning, {0x3E, 5}},
+        {pksm::Ribbon::Victory, {0x3E, 6}},
+        {pksm::Ribbon::Artist, {0x3E, 7}},
+        {pksm::Ribbon::Effort, {0x3F, 0}},
+        {pksm::Ribbon::ChampionBattle, {0x3F, 1}},
+        {pksm::Ribbon::ChampionRegional, {0x3F, 2}},
+        {pksm::Ribbon::ChampionNational, {0x3F, 3}},
+        {pksm::Ribbon::Country, {0x3F, 4}},
+        {pksm::Ribbon::National, {0x3F, 5}},
+        {pksm::Ribbon::Earth, {0x3F, 6}},
+        {pksm::Ribbon::World, {0x3F, 7}},
+        {pksm::Ribbon::G4Cool, {0x60, 0}},
+        {pksm::Ribbon::G4CoolGreat, {0x60, 1}},
+        {pksm::Ribbon::G4CoolUltra, {0x60, 2}},
+        {pksm::Ribbon::G4CoolMaster, {0x60, 3}},
+        {pksm::Ribbon::G4Beauty, {0x60, 4}},
+        {pksm::Ribbon::G4BeautyGreat, {0x60, 5}},
+        {pksm::Ribbon::G4BeautyUltra, {0x60, 6}},
+        {pksm::Ribbon::G4BeautyMaster, {0x60, 7}},
+        {pksm::Ribbon::G4Cute, {0x61, 0}},
+        {pksm::Ribbon::G4CuteGreat, {0x61, 1}},
+        {pksm::Ribbon::G4CuteUltra, {0x61, 2}},
+        {pksm::Ribbon::G4CuteMaster, {0x61, 3}},
+        {pksm::Ribbon::G4Smart, {0x61, 4}},
+        {pksm::Ribbon::G4SmartGreat, {0x61, 5}},
+        {pksm::Ribbon::G4SmartUltra, {0x61, 6}},
+        {pksm::Ribbon::G4SmartMaster, {0x61, 7}},
+        {pksm::Ribbon::G4Tough, {0x62, 0}},
+        {pksm::Ribbon::G4ToughGreat, {0x62, 1}},
+        {pksm::Ribbon::G4ToughUltra, {0x62, 2}},
+        {pksm::Ribbon::G4ToughMaster, {0x62, 3}},
+    });
 
     void fixString(std::u16string& fixString)
     {
@@ -330,6 +243,7 @@ namespace pksm
                 pksm::crypto::pkm::crypt<PARTY_LENGTH - BOX_LENGTH>(data + BOX_LENGTH, PID());
             }
             pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            invalidatePersonal();
         }
     }
 
@@ -349,10 +263,16 @@ namespace pksm
 
     std::unique_ptr<PKX> PK5::clone(void) const
     {
+        counters::add(counters::Counter::PKXClones);
         return PKX::getPKM<Generation::FIVE>(
             const_cast<u8*>(data), isParty() ? PARTY_LENGTH : BOX_LENGTH);
     }
 
+    bool PK5::matchesFilter(const PKFilter& filter) const
+    {
+        return PKView<PK5>(*this).matches(filter);
+    }
+
     Generation PK5::generation(void) const
     {
         return Generation::FIVE;
@@ -393,11 +313,11 @@ namespace pksm
 
     u32 PK5::PID(void) const
     {
-        return LittleEndian::convertTo<u32>(data);
+        return Fields::PID.read(data);
     }
     void PK5::PID(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data, v);
+        Fields::PID.write(data, v);
     }
 
     u16 PK5::sanity(void) const
@@ -420,47 +340,48 @@ namespace pksm
 
     Species PK5::species(void) const
     {
-        return Species{LittleEndian::convertTo<u16>(data + 0x08)};
+        return Species{Fields::Species.read(data)};
     }
     void PK5::species(Species v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x08, u16(v));
+        Fields::Species.write(data, u16(v));
+        invalidatePersonal();
     }
 
     u16 PK5::heldItem(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0A);
+        return Fields::HeldItem.read(data);
     }
     void PK5::heldItem(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0A, v);
+        Fields::HeldItem.write(data, v);
     }
 
     u16 PK5::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0C);
+        return Fields::TID.read(data);
     }
     void PK5::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0C, v);
+        Fields::TID.write(data, v);
     }
 
     u16 PK5::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0E);
+        return Fields::SID.read(data);
     }
     void PK5::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0E, v);
+        Fields::SID.write(data, v);
     }
 
     u32 PK5::experience(void) const
     {
-        return LittleEndian::convertTo<u32>(data + 0x10);
+        return Fields::Experience.read(data);
     }
     void PK5::experience(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data + 0x10, v);
+        Fields::Experience.write(data, v);
     }
 
     u8 PK5::otFriendship(void) const
@@ -474,11 +395,11 @@ namespace pksm
 
     Ability PK5::ability(void) const
     {
-        return Ability{data[0x15]};
+        return Ability{Fields::Ability.read(data)};
     }
     void PK5::ability(Ability v)
     {
-        data[0x15] = u8(v);
+        Fields::Ability.write(data, u8(v));
     }
 
     void PK5::setAbility(u8 v)
@@ -507,11 +428,11 @@ namespace pksm
 
     Language PK5::language(void) const
     {
-        return Language(data[0x17]);
+        return Language(Fields::Language.read(data));
     }
     void PK5::language(Language v)
     {
-        data[0x17] = u8(v);
+        Fields::Language.write(data, u8(v));
     }
 
     u16 PK5::ev(Stat ev) const
@@ -534,33 +455,33 @@ namespace pksm
 
     bool PK5::hasRibbon(Ribbon ribbon) const
     {
-        return OFFSET_OF(ribbon).first != RIBBON_ABSENT;
+        return ribbonBit(RIBBONS, ribbon).present();
     }
     bool PK5::ribbon(Ribbon ribbon) const
     {
-        auto offset = OFFSET_OF(ribbon);
-        if (offset.first != RIBBON_ABSENT)
+        const RibbonBit bit = ribbonBit(RIBBONS, ribbon);
+        if (bit.present())
         {
-            return FlagUtil::getFlag(data, offset.first, offset.second);
+            return FlagUtil::getFlag(data, bit.offset, bit.bit);
         }
         return false;
     }
     void PK5::ribbon(Ribbon ribbon, bool v)
     {
-        auto offset = OFFSET_OF(ribbon);
-        if (offset.first != RIBBON_ABSENT)
+        const RibbonBit bit = ribbonBit(RIBBONS, ribbon);
+        if (bit.present())
         {
-            FlagUtil::setFlag(data, offset.first, offset.second, v);
+            FlagUtil::setFlag(data, bit.offset, bit.bit, v);
         }
     }
 
     Move PK5::move(u8 m) const
     {
-        return Move{LittleEndian::convertTo<u16>(data + 0x28 + m * 2)};
+        return Move{Fields::Move.at(m).read(data)};
     }
     void PK5::move(u8 m, Move v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x28 + m * 2, u16(v));
+        Fields::Move.at(m).write(data, u16(v));
     }
 
     u8 PK5::PP(u8 m) const
@@ -638,20 +559,21 @@ namespace pksm
 
     u16 PK5::alternativeForm(void) const
     {
-        return data[0x40] >> 3;
+        return Fields::AlternativeForm.read(data);
     }
     void PK5::alternativeForm(u16 v)
     {
-        data[0x40] = (data[0x40] & 0x07) | (v << 3);
+        Fields::AlternativeForm.write(data, v);
+        invalidatePersonal();
     }
 
     Nature PK5::nature(void) const
     {
-        return Nature{data[0x41]};
+        return Nature{Fields::Nature.read(data)};
     }
     void PK5::nature(Nature v)
     {
-        data[0x41] = u8(v);
+        Fields::Nature.write(data, u8(v));
     }
 
     bool PK5::hiddenAbility(void) const
@@ -674,11 +596,11 @@ namespace pksm
 
     std::string PK5::nickname(void) const
     {
-        return StringUtils::transString45(StringUtils::getString(data, 0x48, 11, u'\uFFFF'));
+        return StringUtils::getString(data, 0x48, 11, u'\uFFFF', StringUtils::CharSwap::Gen45);
     }
     void PK5::nickname(const std::string_view& v)
     {
-        StringUtils::setString(data, StringUtils::transString45(v), 0x48, 11, u'\uFFFF', 0);
+        StringUtils::setString(data, v, 0x48, 11, u'\uFFFF', 0, StringUtils::CharSwap::Gen45);
     }
 
     GameVersion PK5::version(void) const
@@ -692,11 +614,11 @@ namespace pksm
 
     std::string PK5::otName(void) const
     {
-        return StringUtils::transString45(StringUtils::getString(data, 0x68, 8, u'\uFFFF'));
+        return StringUtils::getString(data, 0x68, 8, u'\uFFFF', StringUtils::CharSwap::Gen45);
     }
     void PK5::otName(const std::string_view& v)
     {
-        StringUtils::setString(data, StringUtils::transString45(v), 0x68, 8, u'\uFFFF', 0);
+        StringUtils::setString(data, v, 0x68, 8, u'\uFFFF', 0, StringUtils::CharSwap::Gen45);
     }
 
     int PK5::eggYear(void) const
@@ -800,20 +722,20 @@ namespace pksm
 
     Ball PK5::ball(void) const
     {
-        return Ball{data[0x83]};
+        return Ball{Fields::Ball.read(data)};
     }
     void PK5::ball(Ball v)
     {
-        data[0x83] = u8(v);
+        Fields::Ball.write(data, u8(v));
     }
 
     u8 PK5::metLevel(void) const
     {
-        return data[0x84] & ~0x80;
+        return Fields::MetLevel.read(data);
     }
     void PK5::metLevel(u8 v)
     {
-        data[0x84] = (data[0x84] & 0x80) | v;
+        Fields::MetLevel.write(data, v);
     }
 
     Gender PK5::otGender(void) const
@@ -895,11 +817,7 @@ namespace pksm
 
     u8 PK5::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-            ;
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK5::level(u8 v)
@@ -942,8 +860,7 @@ namespace pksm
 
     u16 PK5::statImpl(Stat stat) const
     {
-        u16 calc;
-        u8 mult = 10, basestat = 0;
+        u8 basestat = 0;
 
         switch (stat)
         {
@@ -967,16 +884,24 @@ namespace pksm
                 break;
         }
 
-        if (stat == Stat::HP)
-            calc = 10 + (2 * basestat + iv(stat) + ev(stat) / 4 + 100) * level() / 100;
-        else
-            calc = 5 + (2 * basestat + iv(stat) + ev(stat) / 4) * level() / 100;
+        return calcStat(stat, basestat, iv(stat), ev(stat), level(), nature());
+    }
 
-        if (u8(nature()) / 5 + 1 == u8(stat))
-            mult++;
-        if (u8(nature()) % 5 + 1 == u8(stat))
-            mult--;
-        return calc * mult / 10;
+    std::array<u16, 6> PK5::statsImpl(void) const
+    {
+        const PersonalEntry& personal = this->personal();
+        const u8 level                = levelFromExp(experience(), personal.expType);
+        const Nature nature           = this->nature();
+        const u8 baseStats[6]         = {personal.baseHP, personal.baseAtk, personal.baseDef,
+            personal.baseSpe, personal.baseSpa, personal.baseSpd};
+
+        std::array<u16, 6> ret;
+        for (size_t i = 0; i < ret.size(); i++)
+        {
+            const Stat stat = Stat(i);
+            ret[i]          = calcStat(stat, baseStats[i], iv(stat), ev(stat), level, nature);
+        }
+        return ret;
     }
 
     int PK5::partyCurrHP(void) const
@@ -1314,13 +1239,12 @@ namespace pksm
 
     void PK5::updatePartyData()
     {
-        static constexpr Stat stats[] = {
-            Stat::HP, Stat::ATK, Stat::DEF, Stat::SPD, Stat::SPATK, Stat::SPDEF};
-        for (size_t i = 0; i < 6; i++)
+        const std::array<u16, 6> stats = this->stats();
+        for (size_t i = 0; i < stats.size(); i++)
         {
-            partyStat(stats[i], stat(stats[i]));
+            partyStat(Stat(i), stats[i]);
         }
         partyLevel(level());
-        partyCurrHP(stat(Stat::HP));
+        partyCurrHP(stats[size_t(Stat::HP)]);
     }
 }
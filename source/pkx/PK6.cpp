@@ -32,118 +32,65 @@
 #include "pkx/PK5.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "sav/Sav.hpp"
+#include "utils/counters.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/flagUtil.hpp"
 #include "utils/random.hpp"
 #include "utils/utils.hpp"
 
-#define RIBBON_ABSENT 0xFFFFFFFF
-
 namespace
 {
-    std::pair<size_t, size_t> OFFSET_OF(pksm::Ribbon rib)
-    {
-        switch (rib)
-        {
-            case pksm::Ribbon::ChampionKalos:
-                return {0x30, 0};
-            case pksm::Ribbon::ChampionG3Hoenn:
-                return {0x30, 1};
-            case pksm::Ribbon::ChampionSinnoh:
-                return {0x30, 2};
-            case pksm::Ribbon::BestFriends:
-                return {0x30, 3};
-            case pksm::Ribbon::Training:
-                return {0x30, 4};
-            case pksm::Ribbon::BattlerSkillful:
-                return {0x30, 5};
-            case pksm::Ribbon::BattlerExpert:
-                return {0x30, 6};
-            case pksm::Ribbon::Effort:
-                return {0x30, 7};
-            case pksm::Ribbon::Alert:
-                return {0x31, 0};
-            case pksm::Ribbon::Shock:
-                return {0x31, 1};
-            case pksm::Ribbon::Downcast:
-                return {0x31, 2};
-            case pksm::Ribbon::Careless:
-                return {0x31, 3};
-            case pksm::Ribbon::Relax:
-                return {0x31, 4};
-            case pksm::Ribbon::Snooze:
-                return {0x31, 5};
-            case pksm::Ribbon::Smile:
-                return {0x31, 6};
-            case pksm::Ribbon::Gorgeous:
-                return {0x31, 7};
-            case pksm::Ribbon::Royal:
-                return {0x32, 0};
-            case pksm::Ribbon::GorgeousRoyal:
-                return {0x32, 1};
-            case pksm::Ribbon::Artist:
-                return {0x32, 2};
-            case pksm::Ribbon::Footprint:
-                return {0x32, 3};
-            case pksm::Ribbon::Record:
-                return {0x32, 4};
-            case pksm::Ribbon::Legend:
-                return {0x32, 5};
-            case pksm::Ribbon::Country:
-                return {0x32, 6};
-            case pksm::Ribbon::National:
-                return {0x32, 7};
-            case pksm::Ribbon::Earth:
-                return {0x33, 0};
-            case pksm::Ribbon::World:
-                return {0x33, 1};
-            case pksm::Ribbon::Classic:
-                return {0x33, 2};
-            case pksm::Ribbon::Premier:
-                return {0x33, 3};
-            case pksm::Ribbon::Event:
-                return {0x33, 4};
-            case pksm::Ribbon::Birthday:
-                return {0x33, 5};
-            case pksm::Ribbon::Special:
-                return {0x33, 6};
-            case pksm::Ribbon::Souvenir:
-                return {0x33, 7};
-            case pksm::Ribbon::Wishing:
-                return {0x34, 0};
-            case pksm::Ribbon::ChampionBattle:
-                return {0x34, 1};
-            case pksm::Ribbon::ChampionRegional:
-                return {0x34, 2};
-            case pksm::Ribbon::ChampionNational:
-                return {0x34, 3};
-            case pksm::Ribbon::ChampionWorld:
-                return {0x34, 4};
-            case pksm::Ribbon::MemoryContest:
-                return {0x34, 5};
-            case pksm::Ribbon::MemoryBattle:
-                return {0x34, 6};
-            case pksm::Ribbon::ChampionG6Hoenn:
-                return {0x34, 7};
-            case pksm::Ribbon::ContestStar:
-                return {0x35, 0};
-            case pksm::Ribbon::MasterCoolness:
-                return {0x35, 1};
-            case pksm::Ribbon::MasterBeauty:
-                return {0x35, 2};
-            case pksm::Ribbon::MasterCuteness:
-                return {0x35, 3};
-            case pksm::Ribbon::MasterCleverness:
-                return {0x35, 4};
-            case pksm::Ribbon::MasterToughness:
-                return {0x35, 5};
-
-            default:
-                return {RIBBON_ABSENT, 0};
-        }
-    }
+    constexpr pksm::RibbonTable RIBBONS = pksm::makeRibbonTable({
+        {pksm::Ribbon::ChampionKalos, {0x30, 0}},
+        {pksm::Ribbon::ChampionG3Hoenn, {0x30, 1}},
+        {pksm::Ribbon::ChampionSinnoh, {0x30, 2}},
+        {pksm::Ribbon::BestFriends, {0x30, 3}},
+        {pksm::Ribbon::Training, {0x30, 4}},
+        {pksm::Ribbon::BattlerSkillful, {0x30, 5}},
+        {pksm::Ribbon::BattlerExpert, {0x30, 6}},
+        {pksm::Ribbon::Effort, {0x30, 7}},
+        {pksm::Ribbon::Alert, {0x31, 0}},
+        {pksm::Ribbon::Shock, {0x31, 1}},
+        {pksm::Ribbon::Downcast, {0x31, 2}},
+        {pksm::Ribbon::Careless, {0x31, 3}},
+        {pksm::Ribbon::Relax, {0x31, 4}},
+        {pksm::Ribbon::Snooze, {0x31, 5}},
+        {pksm::Ribbon::Smile, {0x31, 6}},
+        {pksm::Ribbon::Gorgeous, {0x31, 7}},
+        {pksm::Ribbon::Royal, {0x32, 0}},
+        {pksm::Ribbon::GorgeousRoyal, {0x32, 1}},
+        {pksm::Ribbon::Artist, {0x32, 2}},
+        {pksm::Ribbon::Footprint, {0x32, 3}},
+        {pksm::Ribbon::Record, {0x32, 4}},
+        {pksm::Ribbon::Legend, {0x32, 5}},
+        {pksm::Ribbon::Country, {0x32, 6}},
+        {pksm::Ribbon::National, {0x32, 7}},
+        {pksm::Ribbon::Earth, {0x33, 0}},
+        {pksm::Ribbon::World, {0x33, 1}},
+        {pksm::Ribbon::Classic, {0x33, 2}},
+        {pksm::Ribbon::Premier, {0x33, 3}},
+        {pksm::Ribbon::Event, {0x33, 4}},
+        {pksm::Ribbon::Birthday, {0x33, 5}},
+        {pksm::Ribbon::Special, {0x33, 6}},
+        {pksm::Ribbon::Souvenir, {0x33, 7}},
+        {pksm::Ribbon::Wishing, {0x34, 0}},
+        {pksm::Ribbon::ChampionBattle, {0x34, 1}},
+        {pksm::Ribbon::ChampionRegional, {0x34, 2}},
+        {pksm::Ribbon::ChampionNational, {0x34, 3}},
+        {pksm::Ribbon::ChampionWorld, {0x34, 4}},
+        {pksm::Ribbon::MemoryContest, {0x34, 5}},
+        {pksm::Ribbon::MemoryBattle, {0x34, 6}},
+        {pksm::Ribbon::ChampionG6Hoenn, {0x34, 7}},
+        {pksm::Ribbon::ContestStar, {0x35, 0}},
+        {pksm::Ribbon::MasterCoolness, {0x35, 1}},
+        {pksm::Ribbon::MasterBeauty, {0x35, 2}},
+        {pksm::Ribbon::MasterCuteness, {0x35, 3}},
+        {pksm::Ribbon::MasterCleverness, {0x35, 4}},
+        {pksm::Ribbon::MasterToughness, {0x35, 5}},
+    });
 }
 
 namespace pksm
@@ -215,6 +162,7 @@ namespace pksm
                     data + BOX_LENGTH, encryptionConstant());
             }
             pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            invalidatePersonal();
         }
     }
 
@@ -235,10 +183,16 @@ namespace pksm
 
     std::unique_ptr<PKX> PK6::clone(void) const
     {
+        counters::add(counters::Counter::PKXClones);
         return PKX::getPKM<Generation::SIX>(
             const_cast<u8*>(data), isParty() ? PARTY_LENGTH : BOX_LENGTH);
     }
 
+    bool PK6::matchesFilter(const PKFilter& filter) const
+    {
+        return PKView<PK6>(*this).matches(filter);
+    }
+
     Generation PK6::generation(void) const
     {
         return Generation::SIX;
@@ -257,11 +211,11 @@ namespace pksm
 
     u32 PK6::encryptionConstant(void) const
     {
-        return LittleEndian::convertTo<u32>(data);
+        return Fields::EncryptionConstant.read(data);
     }
     void PK6::encryptionConstant(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data, v);
+        Fields::EncryptionConstant.write(data, v);
     }
 
     u16 PK6::sanity(void) const
@@ -284,56 +238,57 @@ namespace pksm
 
     Species PK6::species(void) const
     {
-        return Species{LittleEndian::convertTo<u16>(data + 0x08)};
+        return Species{Fields::Species.read(data)};
     }
     void PK6::species(Species v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x08, u16(v));
+        Fields::Species.write(data, u16(v));
+        invalidatePersonal();
     }
 
     u16 PK6::heldItem(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0A);
+        return Fields::HeldItem.read(data);
     }
     void PK6::heldItem(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0A, v);
+        Fields::HeldItem.write(data, v);
     }
 
     u16 PK6::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0C);
+        return Fields::TID.read(data);
     }
     void PK6::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0C, v);
+        Fields::TID.write(data, v);
     }
 
     u16 PK6::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0E);
+        return Fields::SID.read(data);
     }
     void PK6::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0E, v);
+        Fields::SID.write(data, v);
     }
 
     u32 PK6::experience(void) const
     {
-        return LittleEndian::convertTo<u32>(data + 0x10);
+        return Fields::Experience.read(data);
     }
     void PK6::experience(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data + 0x10, v);
+        Fields::Experience.write(data, v);
     }
 
     Ability PK6::ability(void) const
     {
-        return Ability{data[0x14]};
+        return Ability{Fields::Ability.read(data)};
     }
     void PK6::ability(Ability v)
     {
-        data[0x14] = u8(v);
+        Fields::Ability.write(data, u8(v));
     }
 
     void PK6::setAbility(u8 v)
@@ -380,20 +335,20 @@ namespace pksm
 
     u32 PK6::PID(void) const
     {
-        return LittleEndian::convertTo<u32>(data + 0x18);
+        return Fields::PID.read(data);
     }
     void PK6::PID(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data + 0x18, v);
+        Fields::PID.write(data, v);
     }
 
     Nature PK6::nature(void) const
     {
-        return Nature{data[0x1C]};
+        return Nature{Fields::Nature.read(data)};
     }
     void PK6::nature(Nature v)
     {
-        data[0x1C] = u8(v);
+        Fields::Nature.write(data, u8(v));
     }
 
     bool PK6::fatefulEncounter(void) const
@@ -416,11 +371,12 @@ namespace pksm
 
     u16 PK6::alternativeForm(void) const
     {
-        return data[0x1D] >> 3;
+        return Fields::AlternativeForm.read(data);
     }
     void PK6::alternativeForm(u16 v)
     {
-        data[0x1D] = (data[0x1D] & 0x07) | (v << 3);
+        Fields::AlternativeForm.write(data, v);
+        invalidatePersonal();
     }
 
     u16 PK6::ev(Stat ev) const
@@ -479,23 +435,23 @@ namespace pksm
 
     bool PK6::hasRibbon(Ribbon ribbon) const
     {
-        return OFFSET_OF(ribbon).first != RIBBON_ABSENT;
+        return ribbonBit(RIBBONS, ribbon).present();
     }
     bool PK6::ribbon(Ribbon ribbon) const
     {
-        auto offset = OFFSET_OF(ribbon);
-        if (offset.first != RIBBON_ABSENT)
+        const RibbonBit bit = ribbonBit(RIBBONS, ribbon);
+        if (bit.present())
         {
-            return FlagUtil::getFlag(data, offset.first, offset.second);
+            return FlagUtil::getFlag(data, bit.offset, bit.bit);
         }
         return false;
     }
     void PK6::ribbon(Ribbon ribbon, bool v)
     {
-        auto offset = OFFSET_OF(ribbon);
-        if (offset.first != RIBBON_ABSENT)
+        const RibbonBit bit = ribbonBit(RIBBONS, ribbon);
+        if (bit.present())
         {
-            FlagUtil::setFlag(data, offset.first, offset.second, v);
+            FlagUtil::setFlag(data, bit.offset, bit.bit, v);
         }
     }
 
@@ -519,20 +475,20 @@ namespace pksm
 
     std::string PK6::nickname(void) const
     {
-        return StringUtils::transString67(StringUtils::getString(data, 0x40, 13));
+        return StringUtils::getString(data, 0x40, 13, u'\0', StringUtils::CharSwap::Gen67);
     }
     void PK6::nickname(const std::string_view& v)
     {
-        StringUtils::setString(data, StringUtils::transString67(v), 0x40, 13);
+        StringUtils::setString(data, v, 0x40, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
     }
 
     Move PK6::move(u8 m) const
     {
-        return Move{LittleEndian::convertTo<u16>(data + 0x5A + m * 2)};
+        return Move{Fields::Move.at(m).read(data)};
     }
     void PK6::move(u8 m, Move v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x5A + m * 2, u16(v));
+        Fields::Move.at(m).write(data, u16(v));
     }
 
     u8 PK6::PP(u8 m) const
@@ -555,11 +511,11 @@ namespace pksm
 
     Move PK6::relearnMove(u8 m) const
     {
-        return Move{LittleEndian::convertTo<u16>(data + 0x6A + m * 2)};
+        return Move{Fields::RelearnMove.at(m).read(data)};
     }
     void PK6::relearnMove(u8 m, Move v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x6A + m * 2, u16(v));
+        Fields::RelearnMove.at(m).write(data, u16(v));
     }
 
     bool PK6::secretSuperTrainingUnlocked(void) const
@@ -617,11 +573,11 @@ namespace pksm
 
     std::string PK6::htName(void) const
     {
-        return StringUtils::transString67(StringUtils::getString(data, 0x78, 13));
+        return StringUtils::getString(data, 0x78, 13, u'\0', StringUtils::CharSwap::Gen67);
     }
     void PK6::htName(const std::string_view& v)
     {
-        StringUtils::setString(data, StringUtils::transString67(v), 0x78, 13);
+        StringUtils::setString(data, v, 0x78, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
     }
 
     Gender PK6::htGender(void) const
@@ -734,11 +690,11 @@ namespace pksm
 
     std::string PK6::otName(void) const
     {
-        return StringUtils::transString67(StringUtils::getString(data, 0xB0, 13));
+        return StringUtils::getString(data, 0xB0, 13, u'\0', StringUtils::CharSwap::Gen67);
     }
     void PK6::otName(const std::string_view& v)
     {
-        StringUtils::setString(data, StringUtils::transString67(v), 0xB0, 13);
+        StringUtils::setString(data, v, 0xB0, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
     }
 
     u8 PK6::otFriendship(void) const
@@ -869,20 +825,20 @@ namespace pksm
 
     Ball PK6::ball(void) const
     {
-        return Ball{data[0xDC]};
+        return Ball{Fields::Ball.read(data)};
     }
     void PK6::ball(Ball v)
     {
-        data[0xDC] = u8(v);
+        Fields::Ball.write(data, u8(v));
     }
 
     u8 PK6::metLevel(void) const
     {
-        return data[0xDD] & ~0x80;
+        return Fields::MetLevel.read(data);
     }
     void PK6::metLevel(u8 v)
     {
-        data[0xDD] = (data[0xDD] & 0x80) | v;
+        Fields::MetLevel.write(data, v);
     }
 
     Gender PK6::otGender(void) const
@@ -941,11 +897,11 @@ namespace pksm
 
     Language PK6::language(void) const
     {
-        return Language(data[0xE3]);
+        return Language(Fields::Language.read(data));
     }
     void PK6::language(Language v)
     {
-        data[0xE3] = u8(v);
+        Fields::Language.write(data, u8(v));
     }
 
     u8 PK6::currentFriendship(void) const
@@ -1033,11 +989,7 @@ namespace pksm
 
     u8 PK6::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-            ;
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK6::level(u8 v)
@@ -1080,8 +1032,7 @@ namespace pksm
 
     u16 PK6::statImpl(Stat stat) const
     {
-        u16 calc;
-        u8 mult = 10, basestat = 0;
+        u8 basestat = 0;
 
         switch (stat)
         {
@@ -1105,15 +1056,24 @@ namespace pksm
                 break;
         }
 
-        if (stat == Stat::HP)
-            calc = 10 + (2 * basestat + iv(stat) + ev(stat) / 4 + 100) * level() / 100;
-        else
-            calc = 5 + (2 * basestat + iv(stat) + ev(stat) / 4) * level() / 100;
-        if (u8(nature()) / 5 + 1 == u8(stat))
-            mult++;
-        if (u8(nature()) % 5 + 1 == u8(stat))
-            mult--;
-        return calc * mult / 10;
+        return calcStat(stat, basestat, iv(stat), ev(stat), level(), nature());
+    }
+
+    std::array<u16, 6> PK6::statsImpl(void) const
+    {
+        const PersonalEntry& personal = this->personal();
+        const u8 level                = levelFromExp(experience(), personal.expType);
+        const Nature nature           = this->nature();
+        const u8 baseStats[6]         = {personal.baseHP, personal.baseAtk, personal.baseDef,
+            personal.baseSpe, personal.baseSpa, personal.baseSpd};
+
+        std::array<u16, 6> ret;
+        for (size_t i = 0; i < ret.size(); i++)
+        {
+            const Stat stat = Stat(i);
+            ret[i]          = calcStat(stat, baseStats[i], iv(stat), ev(stat), level, nature);
+        }
+        return ret;
     }
 
     int PK6::partyCurrHP(void) const
@@ -1396,13 +1356,12 @@ namespace pksm
 
     void PK6::updatePartyData()
     {
-        static constexpr Stat stats[] = {
-            Stat::HP, Stat::ATK, Stat::DEF, Stat::SPD, Stat::SPATK, Stat::SPDEF};
-        for (size_t i = 0; i < 6; i++)
+        const std::array<u16, 6> stats = this->stats();
+        for (size_t i = 0; i < stats.size(); i++)
         {
-            partyStat(stats[i], stat(stats[i]));
+            partyStat(Stat(i), stats[i]);
         }
         partyLevel(level());
-        partyCurrHP(stat(Stat::HP));
+        partyCurrHP(stats[size_t(Stat::HP)]);
     }
 }
@@ -25,220 +25,115 @@
  */
 
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
+#include "utils/counters.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/flagUtil.hpp"
 #include "utils/utils.hpp"
 
-#define RIBBON_ABSENT 0xFFFFFFFF
-
 namespace
 {
-    std::pair<size_t, size_t> OFFSET_OF(pksm::Ribbon rib)
-    {
-        switch (rib)
-        {
-            case pksm::Ribbon::ChampionKalos:
-                return {0x34, 0};
-            case pksm::Ribbon::ChampionG3Hoenn:
-                return {0x34, 1};
-            case pksm::Ribbon::ChampionSinnoh:
-                return {0x34, 2};
-            case pksm::Ribbon::BestFriends:
-                return {0x34, 3};
-            case pksm::Ribbon::Training:
-                return {0x34, 4};
-            case pksm::Ribbon::BattlerSkillful:
-                return {0x34, 5};
-            case pksm::Ribbon::BattlerExpert:
-                return {0x34, 6};
-            case pksm::Ribbon::Effort:
-                return {0x34, 7};
-            case pksm::Ribbon::Alert:
-                return {0x35, 0};
-            case pksm::Ribbon::Shock:
-                return {0x35, 1};
-            case pksm::Ribbon::Downcast:
-                return {0x35, 2};
-            case pksm::Ribbon::Careless:
-                return {0x35, 3};
-            case pksm::Ribbon::Relax:
-                return {0x35, 4};
-            case pksm::Ribbon::Snooze:
-                return {0x35, 5};
-            case pksm::Ribbon::Smile:
-                return {0x35, 6};
-            case pksm::Ribbon::Gorgeous:
-                return {0x35, 7};
-            case pksm::Ribbon::Royal:
-                return {0x36, 0};
-            case pksm::Ribbon::GorgeousRoyal:
-                return {0x36, 1};
-            case pksm::Ribbon::Artist:
-                return {0x36, 2};
-            case pksm::Ribbon::Footprint:
-                return {0x36, 3};
-            case pksm::Ribbon::Record:
-                return {0x36, 4};
-            case pksm::Ribbon::Legend:
-                return {0x36, 5};
-            case pksm::Ribbon::Country:
-                return {0x36, 6};
-            case pksm::Ribbon::National:
-                return {0x36, 7};
-            case pksm::Ribbon::Earth:
-                return {0x37, 0};
-            case pksm::Ribbon::World:
-                return {0x37, 1};
-            case pksm::Ribbon::Classic:
-                return {0x37, 2};
-            case pksm::Ribbon::Premier:
-                return {0x37, 3};
-            case pksm::Ribbon::Event:
-                return {0x37, 4};
-            case pksm::Ribbon::Birthday:
-                return {0x37, 5};
-            case pksm::Ribbon::Special:
-                return {0x37, 6};
-            case pksm::Ribbon::Souvenir:
-                return {0x37, 7};
-            case pksm::Ribbon::Wishing:
-                return {0x38, 0};
-            case pksm::Ribbon::ChampionBattle:
-                return {0x38, 1};
-            case pksm::Ribbon::ChampionRegional:
-                return {0x38, 2};
-            case pksm::Ribbon::ChampionNational:
-                return {0x38, 3};
-            case pksm::Ribbon::ChampionWorld:
-                return {0x38, 4};
-            case pksm::Ribbon::MemoryContest:
-                return {0x38, 5};
-            case pksm::Ribbon::MemoryBattle:
-                return {0x38, 6};
-            case pksm::Ribbon::ChampionG6Hoenn:
-                return {0x38, 7};
-            case pksm::Ribbon::ContestStar:
-                return {0x39, 0};
-            case pksm::Ribbon::MasterCoolness:
-                return {0x39, 1};
-            case pksm::Ribbon::MasterBeauty:
-                return {0x39, 2};
-            case pksm::Ribbon::MasterCuteness:
-                return {0x39, 3};
-            case pksm::Ribbon::MasterCleverness:
-                return {0x39, 4};
-            case pksm::Ribbon::MasterToughness:
-                return {0x39, 5};
-            case pksm::Ribbon::ChampionAlola:
-                return {0x39, 6};
-            case pksm::Ribbon::BattleRoyale:
-                return {0x39, 7};
-            case pksm::Ribbon::BattleTreeGreat:
-                return {0x3A, 0};
-            case pksm::Ribbon::BattleTreeMaster:
-                return {0x3A, 1};
-            case pksm::Ribbon::ChampionGalar:
-                return {0x3A, 2};
-            case pksm::Ribbon::TowerMaster:
-                return {0x3A, 3};
-            case pksm::Ribbon::MasterRank:
-                return {0x3A, 4};
-            case pksm::Ribbon::MarkLunchtime:
-                return {0x3A, 5};
-            case pksm::Ribbon::MarkSleepyTime:
-                return {0x3A, 6};
-            case pksm::Ribbon::MarkDusk:
-                return {0x3A, 7};
-            case pksm::Ribbon::MarkDawn:
-                return {0x3B, 0};
-            case pksm::Ribbon::MarkCloudy:
-                return {0x3B, 1};
-            case pksm::Ribbon::MarkRainy:
-                return {0x3B, 2};
-            case pksm::Ribbon::MarkStormy:
-                return {0x3B, 3};
-            case pksm::Ribbon::MarkSnowy:
-                return {0x3B, 4};
-            case pksm::Ribbon::MarkBlizzard:
-                return {0x3B, 5};
-            case pksm::Ribbon::MarkDry:
-                return {0x3B, 6};
-            case pksm::Ribbon::MarkSandstorm:
-                return {0x3B, 7};
-            case pksm::Ribbon::MarkMisty:
-                return {0x40, 0};
-            case pksm::Ribbon::MarkDestiny:
-                return {0x40, 1};
-            case pksm::Ribbon::MarkFishing:
-                return {0x40, 2};
-            case pksm::Ribbon::MarkCurry:
-                return {0x40, 3};
-            case pksm::Ribbon::MarkUncommon:
-                return {0x40, 4};
-            case pksm::Ribbon::MarkRare:
-                return {0x40, 5};
-            case pksm::Ribbon::MarkRowdy:
-                return {0x40, 6};
-            case pksm::Ribbon::MarkAbsentMinded:
-                return {0x40, 7};
-            case pksm::Ribbon::MarkJittery:
-                return {0x41, 0};
-            case pksm::Ribbon::MarkExcited:
-                return {0x41, 1};
-            case pksm::Ribbon::MarkCharismatic:
-                return {0x41, 2};
-            case pksm::Ribbon::MarkCalmness:
-                return {0x41, 3};
-            case pksm::Ribbon::MarkIntense:
-                return {0x41, 4};
-            case pksm::Ribbon::MarkZonedOut:
-                return {0x41, 5};
-            case pksm::Ribbon::MarkJoyful:
-                return {0x41, 6};
-            case pksm::Ribbon::MarkAngry:
-                return {0x41, 7};
-            case pksm::Ribbon::MarkSmiley:
-                return {0x42, 0};
-            case pksm::Ribbon::MarkTeary:
-                return {0x42, 1};
-            case pksm::Ribbon::MarkUpbeat:
-                return {0x42, 2};
-            case pksm::Ribbon::MarkPeeved:
-                return {0x42, 3};
-            case pksm::Ribbon::MarkIntellectual:
-                return {0x42, 4};
-            case pksm::Ribbon::MarkFerocious:
-                return {0x42, 5};
-            case pksm::Ribbon::MarkCrafty:
-                return {0x42, 6};
-            case pksm::Ribbon::MarkScowling:
-                return {0x42, 7};
-            case pksm::Ribbon::MarkKindly:
-                return {0x43, 0};
-            case pksm::Ribbon::MarkFlustered:
-                return {0x43, 1};
-            case pksm::Ribbon::MarkPumpedUp:
-                return {0x43, 2};
-            case pksm::Ribbon::MarkZeroEnergy:
-                return {0x43, 3};
-            case pksm::Ribbon::MarkPrideful:
-                return {0x43, 4};
-            case pksm::Ribbon::MarkUnsure:
-                return {0x43, 5};
-            case pksm::Ribbon::MarkHumble:
-                return {0x43, 6};
-            case pksm::Ribbon::MarkThorny:
-                return {0x43, 7};
-            case pksm::Ribbon::MarkVigor:
-                return {0x44, 0};
-            case pksm::Ribbon::MarkSlump:
-                return {0x44, 1};
-
-            default:
-                return {RIBBON_ABSENT, 0};
-        }
-    }
+    constexpr pksm::RibbonTable RIBBONS = pksm::makeRibbonTable({
+        {pksm::Ribbon::ChampionKalos, {0x34, 0}},
+        {pksm::Ribbon::ChampionG3Hoenn, {0x34, 1}},
+        {pksm::Ribbon::ChampionSinnoh, {0x34, 2}},
+        {pksm::Ribbon::BestFriends, {0x34, 3}},
+        {pksm::Ribbon::Training, {0x34, 4}},
+        {pksm::Ribbon::BattlerSkillful, {0x34, 5}},
+        {pksm::Ribbon::BattlerExpert, {0x34, 6}},
+        {pksm::Ribbon::Effort, {0x34, 7}},
+        {pksm::Ribbon::Alert, {0x35, 0}},
+        {pksm::Ribbon::Shock, {0x35, 1}},
+        {pksm::Ribbon::Downcast, {0x35, 2}},
+        {pksm::Ribbon::Careless, {0x35, 3}},
+        {pksm::Ribbon::Relax, {0x35, 4}},
+        {pksm::Ribbon::Snooze, {0x35, 5}},
+        {pksm::Ribbon::Smile, {0x35, 6}},
+        {pksm::Ribbon::Gorgeous, {0x35, 7}},
+        {pksm::Ribbon::Royal, {0x36, 0}},
+        {pksm::Ribbon::GorgeousRoyal, {0x36, 1}},
+        {pksm::Ribbon::Artist, {0x36, 2}},
+        {pksm::Ribbon::Footprint, {0x36, 3}},
+        {pksm::Ribbon::Record, {0x36, 4}},
+        {pksm::Ribbon::Legend, {0x36, 5}},
+        {pksm::Ribbon::Country, {0x36, 6}},
+        {pksm::Ribbon::National, {0x36, 7}},
+        {pksm::Ribbon::Earth, {0x37, 0}},
+        {pksm::Ribbon::World, {0x37, 1}},
+        {pksm::Ribbon::Classic, {0x37, 2}},
+        {pksm::Ribbon::Premier, {0x37, 3}},
+        {pksm::Ribbon::Event, {0x37, 4}},
+        {pksm::Ribbon::Birthday, {0x37, 5}},
+        {pksm::Ribbon::Special, {0x37, 6}},
+        {pksm::Ribbon::Souvenir, {0x37, 7}},
+        {pksm::Ribbon::Wishing, {0x38, 0}},
+        {pksm::Ribbon::ChampionBattle, {0x38, 1}},
+        {pksm::Ribbon::ChampionRegional, {0x38, 2}},
+        {pksm::Ribbon::ChampionNational, {0x38, 3}},
+        {pksm::Ribbon::ChampionWorld, {0x38, 4}},
+        {pksm::Ribbon::MemoryContest, {0x38, 5}},
+        {pksm::Ribbon::MemoryBattle, {0x38, 6}},
+        {pksm::Ribbon::ChampionG6Hoenn, {0x38, 7}},
+        {pksm::Ribbon::ContestStar, {0x39, 0}},
+        {pksm::Ribbon::MasterCoolness, {0x39, 1}},
+        {pksm::Ribbon::MasterBeauty, {0x39, 2}},
+        {pksm::Ribbon::MasterCuteness, {0x39, 3}},
+        {pksm::Ribbon::MasterCleverness, {0x39, 4}},
+        {pksm::Ribbon::MasterToughness, {0x39, 5}},
+        {pksm::Ribbon::ChampionAlola, {0x39, 6}},
+        {pksm::Ribbon::BattleRoyale, {0x39, 7}},
+        {pksm::Ribbon::BattleTreeGreat, {0x3A, 0}},
+        {pksm::Ribbon::BattleTreeMaster, {0x3A, 1}},
+        {pksm::Ribbon::ChampionGalar, {0x3A, 2}},
+        {pksm::Ribbon::TowerMaster, {0x3A, 3}},
+        {pksm::Ribbon::MasterRank, {0x3A, 4}},
+        {pksm::Ribbon::MarkLunchtime, {0x3A, 5}},
+        {pksm::Ribbon::MarkSleepyTime, {0x3A, 6}},
+        {pksm::Ribbon::MarkDusk, {0x3A, 7}},
+        {pksm::Ribbon::MarkDawn, {0x3B, 0}},
+        {pksm::Ribbon::MarkCloudy, {0x3B, 1}},
+        {pksm::Ribbon::MarkRainy, {0x3B, 2}},
+        {pksm::Ribbon::MarkStormy, {0x3B, 3}},
+        {pksm::Ribbon::MarkSnowy, {0x3B, 4}},
+        {pksm::Ribbon::MarkBlizzard, {0x3B, 5}},
+        {pksm::Ribbon::MarkDry, {0x3B, 6}},
+        {pksm::Ribbon::MarkSandstorm, {0x3B, 7}},
+        {pksm::Ribbon::MarkMisty, {0x40, 0}},
+        {pksm::Ribbon::MarkDestiny, {0x40, 1}},
+        {pksm::Ribbon::MarkFishing, {0x40, 2}},
+        {pksm::Ribbon::MarkCurry, {0x40, 3}},
+        {pksm::Ribbon::MarkUncommon, {0x40, 4}},
+        {pksm::Ribbon::MarkRare, {0x40, 5}},
+        {pksm::Ribbon::MarkRowdy, {0x40, 6}},
+        {pksm::Ribbon::MarkAbsentMinded, {0x40, 7}},
+        {pksm::Ribbon::MarkJittery, {0x41, 0}},
+        {pksm::Ribbon::MarkExcited, {0x41, 1}},
+        {pksm::Ribbon::MarkCharismatic, {0x41, 2}},
+        {pksm::Ribbon::MarkCalmness, {0x41, 3}},
+        {pksm::Ribbon::MarkIntense, {0x41, 4}},
+        {pksm::Ribbon::MarkZonedOut, {0x41, 5}},
+        {pksm::Ribbon::MarkJoyful, {0x41, 6}},
+        {pksm::Ribbon::MarkAngry, {0x41, 7}},
+        {pksm::Ribbon::MarkSmiley, {0x42, 0}},
+        {pksm::Ribbon::MarkTeary, {0x42, 1}},
+        {pksm::Ribbon::MarkUpbeat, {0x42, 2}},
+        {pksm::Ribbon::MarkPeeved, {0x42, 3}},
+        {pksm::Ribbon::MarkIntellectual, {0x42, 4}},
+        {pksm::Ribbon::MarkFerocious, {0x42, 5}},
+        {pksm::Ribbon::MarkCrafty, {0x42, 6}},
+        {pksm::Ribbon::MarkScowling, {0x42, 7}},
+        {pksm::Ribbon::MarkKindly, {0x43, 0}},
+        {pksm::Ribbon::MarkFlustered, {0x43, 1}},
+        {pksm::Ribbon::MarkPumpedUp, {0x43, 2}},
+        {pksm::Ribbon::MarkZeroEnergy, {0x43, 3}},
+        {pksm::Ribbon::MarkPrideful, {0x43, 4}},
+        {pksm::Ribbon::MarkUnsure, {0x43, 5}},
+        {pksm::Ribbon::MarkHumble, {0x43, 6}},
+        {pksm::Ribbon::MarkThorny, {0x43, 7}},
+        {pksm::Ribbon::MarkVigor, {0x44, 0}},
+        {pksm::Ribbon::MarkSlump, {0x44, 1}},
+    });
 }
 
 namespace pksm
@@ -274,6 +169,7 @@ namespace pksm
                     data + BOX_LENGTH, encryptionConstant());
             }
             pksm::crypto::pkm::blockShuffle<BLOCK_LENGTH>(data + ENCRYPTION_START, sv);
+            invalidatePersonal();
         }
     }
 
@@ -294,10 +190,16 @@ namespace pksm
 
     std::unique_ptr<PKX> PK8::clone(void) const
     {
+        counters::add(counters::Counter::PKXClones);
         return PKX::getPKM<Generation::EIGHT>(
             const_cast<u8*>(data), isParty() ? PARTY_LENGTH : BOX_LENGTH);
     }
 
+    bool PK8::matchesFilter(const PKFilter& filter) const
+    {
+        return PKView<PK8>(*this).matches(filter);
+    }
+
     Generation PK8::generation(void) const
     {
         return Generation::EIGHT;
@@ -305,11 +207,11 @@ namespace pksm
 
     u32 PK8::encryptionConstant(void) const
     {
-        return LittleEndian::convertTo<u32>(data);
+        return Fields::EncryptionConstant.read(data);
     }
     void PK8::encryptionConstant(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data, v);
+        Fields::EncryptionConstant.write(data, v);
     }
 
     u16 PK8::sanity(void) const
@@ -332,56 +234,57 @@ namespace pksm
 
     Species PK8::species(void) const
     {
-        return Species{LittleEndian::convertTo<u16>(data + 0x08)};
+        return Species{Fields::Species.read(data)};
     }
     void PK8::species(Species v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x08, u16(v));
+        Fields::Species.write(data, u16(v));
+        invalidatePersonal();
     }
 
     u16 PK8::heldItem(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0A);
+        return Fields::HeldItem.read(data);
     }
     void PK8::heldItem(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0A, v);
+        Fields::HeldItem.write(data, v);
     }
 
     u16 PK8::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0C);
+        return Fields::TID.read(data);
     }
     void PK8::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0C, v);
+        Fields::TID.write(data, v);
     }
 
     u16 PK8::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x0E);
+        return Fields::SID.read(data);
     }
     void PK8::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x0E, v);
+        Fields::SID.write(data, v);
     }
 
     u32 PK8::experience(void) const
     {
-        return LittleEndian::convertTo<u32>(data + 0x10);
+        return Fields::Experience.read(data);
     }
     void PK8::experience(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data + 0x10, v);
+        Fields::Experience.write(data, v);
     }
 
     Ability PK8::ability(void) const
     {
-        return Ability{LittleEndian::convertTo<u16>(data + 0x14)};
+        return Ability{Fields::Ability.read(data)};
     }
     void PK8::ability(Ability v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x14, u16(v));
+        Fields::Ability.write(data, u16(v));
     }
 
     void PK8::setAbility(u8 v)
@@ -437,11 +340,11 @@ namespace pksm
 
     u32 PK8::PID(void) const
     {
-        return LittleEndian::convertTo<u32>(data + 0x1C);
+        return Fields::PID.read(data);
     }
     void PK8::PID(u32 v)
     {
-        LittleEndian::convertFrom<u32>(data + 0x1C, v);
+        Fields::PID.write(data, v);
     }
 
     Nature PK8::origNature(void) const
@@ -455,11 +358,11 @@ namespace pksm
 
     Nature PK8::nature(void) const
     {
-        return Nature{data[0x21]};
+        return Nature{Fields::Nature.read(data)};
     }
     void PK8::nature(Nature v)
     {
-        data[0x21] = u8(v);
+        Fields::Nature.write(data, u8(v));
     }
 
     bool PK8::fatefulEncounter(void) const
@@ -493,11 +396,12 @@ namespace pksm
 
     u16 PK8::alternativeForm(void) const
     {
-        return LittleEndian::convertTo<u16>(data + 0x24);
+        return Fields::AlternativeForm.read(data);
     }
     void PK8::alternativeForm(u16 v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x24, v);
+        Fields::AlternativeForm.write(data, v);
+        invalidatePersonal();
     }
 
     u16 PK8::ev(Stat ev) const
@@ -547,23 +451,23 @@ namespace pksm
 
     bool PK8::hasRibbon(Ribbon ribbon) const
     {
-        return OFFSET_OF(ribbon).first != RIBBON_ABSENT;
+        return ribbonBit(RIBBONS, ribbon).present();
     }
     bool PK8::ribbon(Ribbon ribbon) const
     {
-        auto offset = OFFSET_OF(ribbon);
-        if (offset.first != RIBBON_ABSENT)
+        const RibbonBit bit = ribbonBit(RIBBONS, ribbon);
+        if (bit.present())
         {
-            return FlagUtil::getFlag(data, offset.first, offset.second);
+            return FlagUtil::getFlag(data, bit.offset, bit.bit);
         }
         return false;
     }
     void PK8::ribbon(Ribbon ribbon, bool v)
     {
-        auto offset = OFFSET_OF(ribbon);
-        if (offset.first != RIBBON_ABSENT)
+        const RibbonBit bit = ribbonBit(RIBBONS, ribbon);
+        if (bit.present())
         {
-            FlagUtil::setFlag(data, offset.first, offset.second, v);
+            FlagUtil::setFlag(data, bit.offset, bit.bit, v);
         }
     }
 
@@ -625,20 +529,20 @@ namespace pksm
 
     std::string PK8::nickname(void) const
     {
-        return StringUtils::transString67(StringUtils::getString(data, 0x58, 13));
+        return StringUtils::getString(data, 0x58, 13, u'\0', StringUtils::CharSwap::Gen67);
     }
     void PK8::nickname(const std::string_view& v)
     {
-        StringUtils::setString(data, StringUtils::transString67(v), 0x58, 13);
+        StringUtils::setString(data, v, 0x58, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
     }
 
     Move PK8::move(u8 m) const
     {
-        return Move{LittleEndian::convertTo<u16>(data + 0x72 + m * 2)};
+        return Move{Fields::Move.at(m).read(data)};
     }
     void PK8::move(u8 m, Move v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x72 + m * 2, u16(v));
+        Fields::Move.at(m).write(data, u16(v));
     }
 
     u8 PK8::PP(u8 m) const
@@ -661,11 +565,11 @@ namespace pksm
 
     Move PK8::relearnMove(u8 m) const
     {
-        return Move{LittleEndian::convertTo<u16>(data + 0x82 + m * 2)};
+        return Move{Fields::RelearnMove.at(m).read(data)};
     }
     void PK8::relearnMove(u8 m, Move v)
     {
-        LittleEndian::convertFrom<u16>(data + 0x82 + m * 2, u16(v));
+        Fields::RelearnMove.at(m).write(data, u16(v));
     }
 
     int PK8::partyCurrHP(void) const
@@ -722,11 +626,11 @@ namespace pksm
 
     std::string PK8::htName(void) const
     {
-        return StringUtils::transString67(StringUtils::getString(data, 0xA8, 13));
+        return StringUtils::getString(data, 0xA8, 13, u'\0', StringUtils::CharSwap::Gen67);
     }
     void PK8::htName(const std::string_view& v)
     {
-        StringUtils::setString(data, StringUtils::transString67(v), 0xA8, 13);
+        StringUtils::setString(data, v, 0xA8, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
     }
 
     Gender PK8::htGender(void) const
@@ -848,11 +752,11 @@ namespace pksm
 
     Language PK8::language(void) const
     {
-        return Language(data[0xE2]);
+        return Language(Fields::Language.read(data));
     }
     void PK8::language(Language v)
     {
-        data[0xE2] = u8(v);
+        Fields::Language.write(data, u8(v));
     }
 
     u32 PK8::formDuration(void) const
@@ -875,11 +779,11 @@ namespace pksm
 
     std::string PK8::otName(void) const
     {
-        return StringUtils::transString67(StringUtils::getString(data, 0xF8, 13));
+        return StringUtils::getString(data, 0xF8, 13, u'\0', StringUtils::CharSwap::Gen67);
     }
     void PK8::otName(const std::string_view& v)
     {
-        StringUtils::setString(data, StringUtils::transString67(v), 0xF8, 13);
+        StringUtils::setString(data, v, 0xF8, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
     }
 
     u8 PK8::otFriendship(void) const
@@ -1001,20 +905,20 @@ namespace pksm
 
     Ball PK8::ball(void) const
     {
-        return Ball{data[0x124]};
+        return Ball{Fields::Ball.read(data)};
     }
     void PK8::ball(Ball v)
     {
-        data[0x124] = u8(v);
+        Fields::Ball.write(data, u8(v));
     }
 
     u8 PK8::metLevel(void) const
     {
-        return data[0x125] & ~0x80;
+        return Fields::MetLevel.read(data);
     }
     void PK8::metLevel(u8 v)
     {
-        data[0x125] = (data[0x125] & 0x80) | v;
+        Fields::MetLevel.write(data, v);
     }
 
     Gender PK8::otGender(void) const
@@ -1191,11 +1095,7 @@ namespace pksm
 
     u8 PK8::level(void) const
     {
-        u8 i      = 1;
-        u8 xpType = expType();
-        while (experience() >= expTable(i, xpType) && ++i < 100)
-            ;
-        return i;
+        return levelFromExp(experience(), expType());
     }
 
     void PK8::level(u8 v)
@@ -1238,8 +1138,7 @@ namespace pksm
 
     u16 PK8::statImpl(Stat stat) const
     {
-        u16 calc;
-        u8 mult = 10, basestat = 0;
+        u8 basestat = 0;
 
         switch (stat)
         {
@@ -1263,34 +1162,36 @@ namespace pksm
                 break;
         }
 
-        if (stat == Stat::HP)
-            calc =
-                10 + ((2 * basestat) +
-                         ((((data[0xDE] >> hyperTrainLookup[u8(stat)]) & 1) == 1) ? 31 : iv(stat)) +
-                         ev(stat) / 4 + 100) *
-                         level() / 100;
-        else
-            calc =
-                5 + (2 * basestat +
-                        ((((data[0xDE] >> hyperTrainLookup[u8(stat)]) & 1) == 1) ? 31 : iv(stat)) +
-                        ev(stat) / 4) *
-                        level() / 100;
-        if (u8(nature()) / 5 + 1 == u8(stat))
-            mult++;
-        if (u8(nature()) % 5 + 1 == u8(stat))
-            mult--;
-        return calc * mult / 10;
+        return calcStat(
+            stat, basestat, hyperTrain(stat) ? 31 : iv(stat), ev(stat), level(), nature());
+    }
+
+    std::array<u16, 6> PK8::statsImpl(void) const
+    {
+        const PersonalEntry& personal = this->personal();
+        const u8 level                = levelFromExp(experience(), personal.expType);
+        const Nature nature           = this->nature();
+        const u8 baseStats[6]         = {personal.baseHP, personal.baseAtk, personal.baseDef,
+            personal.baseSpe, personal.baseSpa, personal.baseSpd};
+
+        std::array<u16, 6> ret;
+        for (size_t i = 0; i < ret.size(); i++)
+        {
+            const Stat stat = Stat(i);
+            const u8 iv     = hyperTrain(stat) ? 31 : this->iv(stat);
+            ret[i]          = calcStat(stat, baseStats[i], iv, ev(stat), level, nature);
+        }
+        return ret;
     }
 
     void PK8::updatePartyData()
     {
-        static constexpr Stat stats[] = {
-            Stat::HP, Stat::ATK, Stat::DEF, Stat::SPD, Stat::SPATK, Stat::SPDEF};
-        for (size_t i = 0; i < 6; i++)
+        const std::array<u16, 6> stats = this->stats();
+        for (size_t i = 0; i < stats.size(); i++)
         {
-            partyStat(stats[i], stat(stats[i]));
+            partyStat(Stat(i), stats[i]);
         }
         partyLevel(level());
-        partyCurrHP(stat(Stat::HP));
+        partyCurrHP(stats[size_t(Stat::HP)]);
     }
 }
@@ -25,6 +25,7 @@
  */
 
 #include "pkx/PKX.hpp"
+#include "personal/PersonalTable.hpp"
 #include "pkx/PB7.hpp"
 #include "pkx/PK1.hpp"
 #include "pkx/PK2.hpp"
@@ -36,8 +37,11 @@
 #include "pkx/PK8.hpp"
 #include "pkx/PKFilter.hpp"
 #include "utils/VersionTables.hpp"
+#include "utils/counters.hpp"
 #include "utils/endian.hpp"
 #include "utils/random.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace pksm
 {
@@ -67,12 +71,14 @@ namespace pksm
             }
             else
             {
+                counters::add(counters::Counter::PKXAllocations);
                 this->data = new u8[length];
                 std::copy(data, data + length, this->data);
             }
         }
         else
         {
+            counters::add(counters::Counter::PKXAllocations);
             this->data = new u8[length];
             std::fill_n(this->data, length, 0);
             this->directAccess = false;
@@ -81,6 +87,7 @@ namespace pksm
 
     PKX::PKX(const PKX& pk)
     {
+        counters::add(counters::Counter::PKXAllocations);
         directAccess = false;
         data         = new u8[length = pk.getLength()];
         std::copy(pk.data, pk.data + length, data);
@@ -104,8 +111,10 @@ namespace pksm
         {
             delete[] data;
         }
-        directAccess = false;
-        data         = new u8[length = pk.getLength()];
+        counters::add(counters::Counter::PKXAllocations);
+        directAccess  = false;
+        data          = new u8[length = pk.getLength()];
+        personalCache = nullptr;
         std::copy(pk.data, pk.data + length, data);
         return *this;
     }
@@ -120,10 +129,11 @@ namespace pksm
         {
             delete[] data;
         }
-        data         = pk.data;
-        length       = pk.length;
-        directAccess = pk.directAccess;
-        pk.data      = nullptr;
+        data          = pk.data;
+        length        = pk.length;
+        directAccess  = pk.directAccess;
+        personalCache = nullptr;
+        pk.data       = nullptr;
         return *this;
     }
 
@@ -135,7 +145,75 @@ namespace pksm
         }
     }
 
+    void PKX::load(std::span<const u8> raw)
+    {
+        std::copy(raw.begin(), raw.end(), data);
+        personalCache = nullptr;
+        if (isEncrypted())
+        {
+            decrypt();
+        }
+    }
+
+    const PersonalEntry& PKX::personal(void) const
+    {
+        const PersonalEntry* entry = personalCache;
+        if (entry == nullptr)
+        {
+            entry         = personalEntry(generation(), formSpecies());
+            personalCache = entry;
+        }
+        return *entry;
+    }
+
     u32 PKX::expTable(u8 row, u8 col) const
+    {
+        return expCurve(col)[row];
+    }
+
+    u8 PKX::levelFromExp(u32 experience, u8 expType)
+    {
+        // Find the last level whose threshold has been reached. Level 1's is 0, so there always is
+        // one; the fixed step count lets each step compile down to a conditional move.
+        const u32* curve = expCurve(expType).data();
+        const u32* base  = curve;
+        size_t size      = 100;
+        while (size > 1)
+        {
+            size_t half = size / 2;
+            base        = base[half] <= experience ? base + half : base;
+            size -= half;
+        }
+        return base - curve + 1;
+    }
+
+    u16 PKX::calcStat(Stat stat, u8 baseStat, u8 iv, u16 ev, u8 level, Nature nature)
+    {
+        u16 calc;
+        u8 mult = 10;
+
+        if (stat == Stat::HP)
+            calc = 10 + (2 * baseStat + iv + ev / 4 + 100) * level / 100;
+        else
+            calc = 5 + (2 * baseStat + iv + ev / 4) * level / 100;
+
+        if (u8(nature) / 5 + 1 == u8(stat))
+            mult++;
+        if (u8(nature) % 5 + 1 == u8(stat))
+            mult--;
+        return calc * mult / 10;
+    }
+
+    u16 PKX::calcStatGB(Stat stat, u8 baseStat, u8 iv, u16 ev, u8 level)
+    {
+        u16 EV  = u16(std::min(255, int(std::ceil(std::sqrt(ev)))) >> 2);
+        u16 mid = u16(((2 * (baseStat + iv) + EV) * level / 100) + 5);
+        if (stat == Stat::HP)
+            return mid + 5 + level;
+        return mid;
+    }
+
+    const std::array<u32, 100>& PKX::expCurve(u8 expType)
     {
         static constexpr u32 table[100][6] = {{0, 0, 0, 0, 0, 0}, {8, 15, 4, 9, 6, 10},
             {27, 52, 13, 57, 21, 33}, {64, 122, 32, 96, 51, 80}, {125, 237, 65, 135, 100, 156},
@@ -215,8 +293,21 @@ namespace pksm
             {941192, 583539, 1524731, 995030, 752953, 1176490},
             {970299, 591882, 1571884, 1027103, 776239, 1212873},
             {1000000, 600000, 1640000, 1059860, 800000, 1250000}};
+        // Stored one growth rate per row so level lookups stay within one contiguous array
+        static constexpr auto curves = []
+        {
+            std::array<std::array<u32, 100>, 6> ret{};
+            for (size_t level = 0; level < 100; level++)
+            {
+                for (size_t type = 0; type < 6; type++)
+                {
+                    ret[type][level] = table[level][type];
+                }
+            }
+            return ret;
+        }();
 
-        return table[row][col];
+        return curves[expType];
     }
 
     void PKX::reorderMoves(void)
@@ -344,47 +435,20 @@ namespace pksm
             return pksm::randomNumber(0, 0xFFFFFFFF);
         }
 
-        u8 (*genderTypeFinder)(u16 species) = nullptr;
-        switch (gen)
-        {
-            case Generation::THREE:
-                genderTypeFinder = PersonalRSFRLGE::gender;
-                break;
-            case Generation::FOUR:
-                genderTypeFinder = PersonalDPPtHGSS::gender;
-                break;
-            case Generation::FIVE:
-                genderTypeFinder = PersonalBWB2W2::gender;
-                break;
-            case Generation::SIX:
-                genderTypeFinder = PersonalXYORAS::gender;
-                break;
-            case Generation::SEVEN:
-                genderTypeFinder = PersonalSMUSUM::gender;
-                break;
-            case Generation::LGPE:
-                genderTypeFinder = PersonalLGPE::gender;
-                break;
-            case Generation::EIGHT:
-                genderTypeFinder = PersonalSWSH::gender;
-                break;
-            case Generation::UNUSED:
-            case Generation::ONE:
-            case Generation::TWO:
-                return 0;
-        }
-        if (!genderTypeFinder)
+        const PersonalEntry* personal = personalEntry(gen, u16(species));
+        if (!personal)
         {
             return 0;
         }
 
-        u8 genderType = genderTypeFinder(u16(species));
+        u8 genderType = personal->gender;
         bool g3unown  = (originGame <= GameVersion::LG || gen == Generation::THREE) &&
                        species == Species::Unown;
         u32 abilityBits = oldPid & (abilityNum == 2 ? 0x00010001 : 0);
         int psvShift    = gen >= Generation::SIX ? 4 : 3;
         while (true)
         {
+            counters::add(counters::Counter::RandomPIDIterations);
             u32 possiblePID = pksm::randomNumber(0, 0xFFFFFFFF);
             if ((Generation)originGame <= Generation::FOUR && (possiblePID % 25) != size_t(nature))
             {
@@ -528,91 +592,7 @@ namespace pksm
 
     bool PKX::operator==(const PKFilter& filter) const
     {
-        if (filter.generationEnabled() &&
-            (filter.generationInversed() != (generation() != filter.generation())))
-        {
-            return false;
-        }
-        if (filter.speciesEnabled() &&
-            (filter.speciesInversed() != (species() != filter.species())))
-        {
-            return false;
-        }
-        if (filter.heldItemEnabled() &&
-            (filter.heldItemInversed() != (heldItem() != filter.heldItem())))
-        {
-            return false;
-        }
-        if (filter.levelEnabled() && (filter.levelInversed() != (level() != filter.level())))
-        {
-            return false;
-        }
-        if (filter.abilityEnabled() &&
-            (filter.abilityInversed() != (ability() != filter.ability())))
-        {
-            return false;
-        }
-        if (filter.TSVEnabled() && (filter.TSVInversed() != (TSV() != filter.TSV())))
-        {
-            return false;
-        }
-        if (filter.natureEnabled() && (filter.natureInversed() != (nature() != filter.nature())))
-        {
-            return false;
-        }
-        if (filter.genderEnabled() && (filter.genderInversed() != (gender() != filter.gender())))
-        {
-            return false;
-        }
-        if (filter.ballEnabled() && (filter.ballInversed() != (ball() != filter.ball())))
-        {
-            return false;
-        }
-        if (filter.languageEnabled() &&
-            (filter.languageInversed() != (language() != filter.language())))
-        {
-            return false;
-        }
-        if (filter.eggEnabled() && (filter.eggInversed() != (egg() != filter.egg())))
-        {
-            return false;
-        }
-        for (int i = 0; i < 4; i++)
-        {
-            if (filter.moveEnabled(i) && (filter.moveInversed(i) != (move(i) != filter.move(i))))
-            {
-                return false;
-            }
-            if (filter.relearnMoveEnabled(i))
-            {
-                if (generation() < Generation::SIX)
-                {
-                    return false;
-                }
-                else if (filter.relearnMoveInversed(i) != (filter.relearnMove(i) != relearnMove(i)))
-                {
-                    return false;
-                }
-            }
-        }
-        for (int i = 0; i < 6; i++)
-        {
-            if (filter.ivEnabled(Stat(i)) &&
-                (filter.ivInversed(Stat(i)) != (iv(Stat(i)) < filter.iv(Stat(i)))))
-            {
-                return false;
-            }
-        }
-        if (filter.shinyEnabled() && (filter.shinyInversed() != (filter.shiny() != shiny())))
-        {
-            return false;
-        }
-        if (filter.alternativeFormEnabled() &&
-            (filter.alternativeFormInversed() != (filter.alternativeForm() != alternativeForm())))
-        {
-            return false;
-        }
-        return true;
+        return matchesFilter(filter);
     }
 
     std::unique_ptr<PK1> PKX::convertToG1(Sav&) const
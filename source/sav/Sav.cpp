@@ -34,7 +34,9 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PKView.hpp"
 #include "pkx/PKX.hpp"
+#include "sav/ItemTable.hpp"
 #include "sav/Sav1.hpp"
 #include "sav/Sav2.hpp"
 #include "sav/SavB2W2.hpp"
@@ -50,174 +52,89 @@
 #include "sav/SavSUMO.hpp"
 #include "sav/SavSWSH.hpp"
 #include "sav/SavUSUM.hpp"
+#include "sav/SaveDetection.hpp"
 #include "sav/SavXY.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/ValueConverter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 namespace pksm
 {
     std::unique_ptr<Sav> Sav::getSave(const std::shared_ptr<u8[]>& dt, size_t length)
     {
-        switch (length)
-        {
-            case 0x6CC00:
-                return std::make_unique<SavUSUM>(dt);
-            case 0x6BE00:
-                return std::make_unique<SavSUMO>(dt);
-            case 0x76000:
-                return std::make_unique<SavORAS>(dt);
-            case 0x65600:
-                return std::make_unique<SavXY>(dt);
-            case 0x80000:
-                return checkDSType(dt);
-            case 0x20000:
-                return checkGBAType(dt);
-            case 0x8000:
-            case 0x10000:
-            // Gen II VC saves
-            case 0x8010:
-            case 0x10010:
-            // Emulator standard saves
-            case 0x8030:
-            case 0x10030:
-                return checkGBType(dt, length);
-            case 0xB8800:
-            case 0x100000:
-                return std::make_unique<SavLGPE>(dt, length);
-            case SavSWSH::SIZE_G8SWSH:
-            case SavSWSH::SIZE_G8SWSH_1:
-            case SavSWSH::SIZE_G8SWSH_2:
-            case SavSWSH::SIZE_G8SWSH_2B:
-            case SavSWSH::SIZE_G8SWSH_3:
-            case SavSWSH::SIZE_G8SWSH_3A:
-            case SavSWSH::SIZE_G8SWSH_3B:
-            case SavSWSH::SIZE_G8SWSH_3C:
-                return std::make_unique<SavSWSH>(dt, length);
-            default:
-                return std::unique_ptr<Sav>(nullptr);
-        }
+        return openSave(dt, length);
     }
-    std::unique_ptr<Sav> Sav::checkGBType(const std::shared_ptr<u8[]>& dt, size_t length)
+
+    std::unique_ptr<const Sav> Sav::getSave(
+        const std::shared_ptr<u8[]>& dt, size_t length, ReadOnly_t)
     {
-        std::tuple<GameVersion, Language, bool> versionAndLanguage = Sav2::getVersion(dt);
+        return openSave(dt, length);
+    }
 
-        if (get<2>(versionAndLanguage))
-        {
-            return std::make_unique<Sav2>(dt, length, versionAndLanguage);
-        }
+    std::unique_ptr<const Sav> Sav::getSave(const std::shared_ptr<u8[]>& dt, size_t length,
+        const SaveCandidate& format, ReadOnly_t, bool scratch)
+    {
+        return openSave(dt, length, format, scratch);
+    }
 
-        switch (Sav1::getVersion(dt))
+    std::unique_ptr<Sav> Sav::openSave(const std::shared_ptr<u8[]>& dt, size_t length)
+    {
+        std::vector<SaveCandidate> candidates = detectSaveFormat({dt.get(), length});
+        if (candidates.empty())
         {
-            case Game::RGB:
-                return std::make_unique<Sav1>(dt, length);
-            case Game::Y:
-                return std::make_unique<Sav1>(dt, length); // in case anyone wants to
-            default:
-                return std::unique_ptr<Sav>(nullptr);
+            return nullptr;
         }
+        return openSave(dt, length, candidates.front(), false);
     }
 
-    std::unique_ptr<Sav> Sav::checkGBAType(const std::shared_ptr<u8[]>& dt)
+    std::unique_ptr<Sav> Sav::openSave(const std::shared_ptr<u8[]>& dt, size_t length,
+        const SaveCandidate& best, bool scratch)
     {
-        switch (Sav3::getVersion(dt))
+        switch (best.format)
         {
-            case Game::RS:
+            case SaveFormat::USUM:
+                return std::make_unique<SavUSUM>(dt);
+            case SaveFormat::SM:
+                return std::make_unique<SavSUMO>(dt);
+            case SaveFormat::ORAS:
+                return std::make_unique<SavORAS>(dt);
+            case SaveFormat::XY:
+                return std::make_unique<SavXY>(dt);
+            case SaveFormat::DP:
+                return std::make_unique<SavDP>(dt);
+            case SaveFormat::Pt:
+                return std::make_unique<SavPT>(dt);
+            case SaveFormat::HGSS:
+                return std::make_unique<SavHGSS>(dt);
+            case SaveFormat::BW:
+                return std::make_unique<SavBW>(dt);
+            case SaveFormat::B2W2:
+                return std::make_unique<SavB2W2>(dt);
+            case SaveFormat::RS:
                 return std::make_unique<SavRS>(dt);
-            case Game::E:
+            case SaveFormat::E:
                 return std::make_unique<SavE>(dt);
-            case Game::FRLG:
+            case SaveFormat::FRLG:
                 return std::make_unique<SavFRLG>(dt);
-            default:
-                return std::unique_ptr<Sav>(nullptr);
-        }
-    }
-
-    bool Sav::isValidDSSave(const std::shared_ptr<u8[]>& dt)
-    {
-        u16 chk1    = LittleEndian::convertTo<u16>(&dt[0x24000 - 0x100 + 0x8C + 0xE]);
-        u16 actual1 = pksm::crypto::ccitt16({&dt[0x24000 - 0x100], 0x8C});
-        if (chk1 == actual1)
-        {
-            return true;
-        }
-        u16 chk2    = LittleEndian::convertTo<u16>(&dt[0x26000 - 0x100 + 0x94 + 0xE]);
-        u16 actual2 = pksm::crypto::ccitt16({&dt[0x26000 - 0x100], 0x94});
-        if (chk2 == actual2)
-        {
-            return true;
-        }
-
-        // Check for block identifiers
-        static constexpr size_t DP_OFFSET   = 0xC100;
-        static constexpr size_t PT_OFFSET   = 0xCF2C;
-        static constexpr size_t HGSS_OFFSET = 0xF628;
-        if (validSequence(dt, DP_OFFSET))
-            return true;
-        if (validSequence(dt, PT_OFFSET))
-            return true;
-        if (validSequence(dt, HGSS_OFFSET))
-            return true;
-
-        // Check the other save
-        if (validSequence(dt, DP_OFFSET + 0x40000))
-            return true;
-        if (validSequence(dt, PT_OFFSET + 0x40000))
-            return true;
-        if (validSequence(dt, HGSS_OFFSET + 0x40000))
-            return true;
-        return false;
-    }
-
-    std::unique_ptr<Sav> Sav::checkDSType(const std::shared_ptr<u8[]>& dt)
-    {
-        // Check for block identifiers
-        static constexpr size_t DP_OFFSET   = 0xC100;
-        static constexpr size_t PT_OFFSET   = 0xCF2C;
-        static constexpr size_t HGSS_OFFSET = 0xF628;
-        if (validSequence(dt, DP_OFFSET))
-            return std::make_unique<SavDP>(dt);
-        if (validSequence(dt, PT_OFFSET))
-            return std::make_unique<SavPT>(dt);
-        if (validSequence(dt, HGSS_OFFSET))
-            return std::make_unique<SavHGSS>(dt);
-
-        // Check the other save
-        if (validSequence(dt, DP_OFFSET + 0x40000))
-            return std::make_unique<SavDP>(dt);
-        if (validSequence(dt, PT_OFFSET + 0x40000))
-            return std::make_unique<SavPT>(dt);
-        if (validSequence(dt, HGSS_OFFSET + 0x40000))
-            return std::make_unique<SavHGSS>(dt);
-
-        // Check for BW/B2W2 checksums
-        u16 chk1    = LittleEndian::convertTo<u16>(&dt[0x24000 - 0x100 + 0x8C + 0xE]);
-        u16 actual1 = pksm::crypto::ccitt16({&dt[0x24000 - 0x100], 0x8C});
-        if (chk1 == actual1)
-        {
-            return std::make_unique<SavBW>(dt);
-        }
-        u16 chk2    = LittleEndian::convertTo<u16>(&dt[0x26000 - 0x100 + 0x94 + 0xE]);
-        u16 actual2 = pksm::crypto::ccitt16({&dt[0x26000 - 0x100], 0x94});
-        if (chk2 == actual2)
-        {
-            return std::make_unique<SavB2W2>(dt);
+            case SaveFormat::GSC:
+                return std::make_unique<Sav2>(
+                    dt, length, std::tuple{best.version, best.language, true});
+            case SaveFormat::RGBY:
+                return std::make_unique<Sav1>(dt, length);
+            case SaveFormat::LGPE:
+                return std::make_unique<SavLGPE>(dt, length);
+            case SaveFormat::SWSH:
+                return std::make_unique<SavSWSH>(dt, length, scratch);
         }
         return nullptr;
     }
 
-    bool Sav::validSequence(const std::shared_ptr<u8[]>& dt, size_t offset)
+    bool Sav::isValidDSSave(const std::shared_ptr<u8[]>& dt)
     {
-        static constexpr u32 DATE_INTERNATIONAL = 0x20060623;
-        static constexpr u32 DATE_KOREAN        = 0x20070903;
-
-        if (LittleEndian::convertTo<u32>(&dt[offset - 0xC]) != (offset & 0xFFFF))
-        {
-            return false;
-        }
-
-        return LittleEndian::convertTo<u32>(&dt[offset - 0x8]) == DATE_INTERNATIONAL ||
-               LittleEndian::convertTo<u32>(&dt[offset - 0x8]) == DATE_KOREAN;
+        return !detectSaveFormat({dt.get(), 0x80000}).empty();
     }
 
     std::unique_ptr<PKX> Sav::transfer(const PKX& pk)
@@ -250,24 +167,22 @@ namespace pksm
 
     void Sav::fixParty()
     {
-        // Poor man's bubble sort-like thing
-        int numPkm = 6;
-        for (int i = 5; i > 0; i--)
+        // Stable single pass: slide every occupied slot down over the empty ones before it
+        int numPkm = 0;
+        for (int i = 0; i < 6; i++)
         {
             auto checkPKM = pkm(i);
             if (checkPKM->species() == Species::None)
             {
-                numPkm--;
                 continue;
             }
-            auto prevPKM = pkm(i - 1);
-            if (checkPKM->species() != Species::None && prevPKM->species() == Species::None)
+            if (i != numPkm)
             {
-                pkm(*checkPKM, i - 1);
-                pkm(*prevPKM, i);
-                numPkm = 6;
-                i      = 6; // reset loop
+                auto emptyPKM = pkm(numPkm);
+                pkm(*checkPKM, numPkm);
+                pkm(*emptyPKM, i);
             }
+            numPkm++;
         }
         partyCount(numPkm);
     }
@@ -315,6 +230,17 @@ namespace pksm
     }
 
     Sav::BadTransferReason Sav::invalidTransferReason(const PKX& pk) const
+    {
+        // visitFormat would return OKAY for this
+        if (pk.generation() == Generation::UNUSED)
+        {
+            return BadTransferReason::FORMAT;
+        }
+        return visitFormat(pk, [this](const auto& concrete) { return transferReason(concrete); });
+    }
+
+    template <typename Pkm>
+    Sav::BadTransferReason Sav::transferReason(const Pkm& pk) const
     {
         bool moveBad = false;
         for (int i = 0; i < 4; i++)
@@ -353,31 +279,44 @@ namespace pksm
                 return BadTransferReason::ABILITY;
             }
         }
-        
+
         if (generation() <= Generation::TWO)
         {
-            const int heldItem2 = pk.generation() == Generation::ONE
-                                        ? (int)static_cast<const PK1&>(pk).heldItem2()
-                                        : (pk.generation() == Generation::TWO
-                                            ? (int)static_cast<const PK2&>(pk).heldItem2()
-                                            : (int)ItemConverter::nationalToG2(pk.heldItem()));
+            int heldItem2;
+            if constexpr (std::is_same_v<Pkm, PK1> || std::is_same_v<Pkm, PK2>)
+            {
+                heldItem2 = pk.heldItem2();
+            }
+            else
+            {
+                heldItem2 = ItemConverter::nationalToG2(pk.heldItem());
+            }
             // Crystal only adds key items
-            if (VersionTables::availableItems(GameVersion::GD).count(heldItem2) == 0 || (heldItem2 == 0 && pk.heldItem() != 0))
+            if (VersionTables::availableItems(GameVersion::GD).count(heldItem2) == 0 ||
+                (heldItem2 == 0 && pk.heldItem() != 0))
             {
                 return BadTransferReason::ITEM;
             }
         }
         else if (generation() == Generation::THREE)
         {
-            const int heldItem3 = pk.generation() == Generation::THREE
-                                        ? (int)static_cast<const PK3&>(pk).heldItem3()
-                                        : (int)ItemConverter::nationalToG3(pk.heldItem());
+            int heldItem3;
+            if constexpr (std::is_same_v<Pkm, PK3>)
+            {
+                heldItem3 = pk.heldItem3();
+            }
+            else
+            {
+                heldItem3 = ItemConverter::nationalToG3(pk.heldItem());
+            }
             if (availableItems().count(heldItem3) == 0 || (heldItem3 == 0 && pk.heldItem() != 0))
             {
                 return BadTransferReason::ITEM;
             }
         }
-        else if (availableItems().count((int)pk.heldItem()) == 0 || (pk.generation() == Generation::THREE && pk.heldItem() == ItemConverter::ITEM_NOT_CONVERTIBLE))
+        else if (availableItems().count((int)pk.heldItem()) == 0 ||
+                 (pk.generation() == Generation::THREE &&
+                     pk.heldItem() == ItemConverter::ITEM_NOT_CONVERTIBLE))
         {
             return BadTransferReason::ITEM;
         }
@@ -391,4 +330,254 @@ namespace pksm
         }
         return BadTransferReason::OKAY;
     }
+
+    std::map<Sav::Pouch, std::vector<int>> Sav::validItems() const
+    {
+        const ItemTable& table = itemTable();
+        std::map<Pouch, std::vector<int>> ret;
+        for (Pouch pouch : table.pouches())
+        {
+            auto items = table.items(pouch);
+            ret.emplace(pouch, std::vector<int>(items.begin(), items.end()));
+        }
+        return ret;
+    }
+
+    u16 Sav::pouchSize(Pouch pouch) const
+    {
+        for (const auto& [which, size] : pouches())
+        {
+            if (which == pouch)
+            {
+                return size;
+            }
+        }
+        return 0;
+    }
+
+    size_t Sav::readPouch(Pouch pouch, std::span<ItemEntry> out) const
+    {
+        size_t count = std::min(out.size(), size_t(pouchSize(pouch)));
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            auto read = item(pouch, slot);
+            out[slot] = read ? ItemEntry{read->id(), read->count(), 0} : ItemEntry{};
+        }
+        return count;
+    }
+
+    void Sav::writePouch(Pouch pouch, std::span<const ItemEntry> items)
+    {
+        size_t count = std::min(items.size(), size_t(pouchSize(pouch)));
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            // Reuse the slot's own Item so that the save's item format is kept
+            auto write = item(pouch, slot);
+            if (!write)
+            {
+                return;
+            }
+            write->id(items[slot].id);
+            write->count(items[slot].count);
+            item(*write, pouch, slot);
+        }
+    }
+
+    namespace
+    {
+        // Delta layout, all little endian:
+        //   u32 magic, u8 game, u32 save length, u8[32] hash of the base's blocks, u32 record count
+        //   per record: u16 block index, u32 offset in block, u32 run length, run bytes
+        constexpr u32 DELTA_MAGIC     = 0x4C445653; // "SVDL"
+        constexpr size_t HASH_LEN     = 32;
+        constexpr size_t HASH_OFS     = 4 + 1 + 4;
+        constexpr size_t COUNT_OFS    = HASH_OFS + HASH_LEN;
+        constexpr size_t DELTA_HEADER = COUNT_OFS + 4;
+        constexpr size_t DELTA_RECORD = 2 + 4 + 4;
+
+        // Identifies the save a delta was made against, so that it can't be applied to another
+        // save of the same game
+        std::array<u8, HASH_LEN> blockHash(
+            const u8* data, const std::vector<Sav::BlockRange>& blocks)
+        {
+            crypto::SHA256 hash;
+            for (const Sav::BlockRange& block : blocks)
+            {
+                hash.update({data + block.offset, block.length});
+            }
+            return hash.finish();
+        }
+    }
+
+    void Sav::forEachBoxSlot(const std::function<void(u8 box, u8 slot, const PKX& pk)>& visit,
+        bool occupiedOnly, unsigned threads) const
+    {
+        const int boxes = maxBoxes();
+        const int slots = boxSlots();
+        const int total = maxSlot();
+
+        std::atomic<int> nextBox = 0;
+
+        auto work = [&] {
+            // Allocated by the first pkm() call, then refilled in place for each slot
+            std::unique_ptr<PKX> scratch;
+            for (int box = nextBox++; box < boxes; box = nextBox++)
+            {
+                for (int slot = 0; slot < slots && box * slots + slot < total; slot++)
+                {
+                    std::span<const u8> raw = boxSlotData(box, slot);
+                    if (scratch && !raw.empty() && raw.size() == scratch->getLength())
+                    {
+                        scratch->load(raw);
+                    }
+                    else
+                    {
+                        scratch = pkm(box, slot);
+                    }
+                    if (!occupiedOnly || scratch->species() != Species::None)
+                    {
+                        visit(box, slot, *scratch);
+                    }
+                }
+            }
+        };
+
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        (void)threads;
+        work();
+#else
+        if (threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        threads = std::min(threads, unsigned(boxes));
+
+        std::vector<std::thread> workers;
+        for (unsigned i = 1; i < threads; i++)
+        {
+            workers.emplace_back(work);
+        }
+        work();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+#endif
+    }
+
+    std::vector<u8> Sav::blockDelta(const Sav& base) const
+    {
+        const std::vector<BlockRange> blocks     = blockMap();
+        const std::vector<BlockRange> baseBlocks = base.blockMap();
+        if (blocks.empty() || game != base.game || length != base.length ||
+            blocks.size() != baseBlocks.size())
+        {
+            return {};
+        }
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            if (blocks[i].length != baseBlocks[i].length)
+            {
+                return {};
+            }
+        }
+
+        std::vector<u8> ret(DELTA_HEADER);
+        LittleEndian::convertFrom<u32>(ret.data(), DELTA_MAGIC);
+        ret[4] = u8(game);
+        LittleEndian::convertFrom<u32>(ret.data() + 5, length);
+        const std::array<u8, HASH_LEN> baseHash = blockHash(base.data.get(), baseBlocks);
+        std::copy(baseHash.begin(), baseHash.end(), ret.data() + HASH_OFS);
+
+        u32 count = 0;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            const u8* now  = &data[blocks[i].offset];
+            const u8* then = &base.data[baseBlocks[i].offset];
+            size_t pos     = 0;
+            while (pos < blocks[i].length)
+            {
+                pos = std::mismatch(now + pos, now + blocks[i].length, then + pos).first - now;
+                if (pos == blocks[i].length)
+                {
+                    break;
+                }
+                // Unchanged gaps shorter than a record header are cheaper to carry in the run
+                size_t end = pos + 1;
+                for (size_t j = end; j < blocks[i].length && j - end < DELTA_RECORD; j++)
+                {
+                    if (now[j] != then[j])
+                    {
+                        end = j + 1;
+                    }
+                }
+
+                const size_t ofs = ret.size();
+                ret.resize(ofs + DELTA_RECORD + end - pos);
+                LittleEndian::convertFrom<u16>(ret.data() + ofs, i);
+                LittleEndian::convertFrom<u32>(ret.data() + ofs + 2, pos);
+                LittleEndian::convertFrom<u32>(ret.data() + ofs + 6, end - pos);
+                std::copy(now + pos, now + end, ret.data() + ofs + DELTA_RECORD);
+                count++;
+                pos = end;
+            }
+        }
+        LittleEndian::convertFrom<u32>(ret.data() + COUNT_OFS, count);
+
+        return ret;
+    }
+
+    bool Sav::applyBlockDelta(std::span<const u8> delta)
+    {
+        const std::vector<BlockRange> blocks = blockMap();
+        if (blocks.empty() || delta.size() < DELTA_HEADER ||
+            LittleEndian::convertTo<u32>(delta.data()) != DELTA_MAGIC || delta[4] != u8(game) ||
+            LittleEndian::convertTo<u32>(delta.data() + 5) != length)
+        {
+            return false;
+        }
+        const std::array<u8, HASH_LEN> hash = blockHash(data.get(), blocks);
+        if (!std::equal(hash.begin(), hash.end(), delta.begin() + HASH_OFS))
+        {
+            return false;
+        }
+
+        // Validate every record before touching the save
+        const u32 count = LittleEndian::convertTo<u32>(delta.data() + COUNT_OFS);
+        size_t ofs      = DELTA_HEADER;
+        for (u32 i = 0; i < count; i++)
+        {
+            if (delta.size() - ofs < DELTA_RECORD)
+            {
+                return false;
+            }
+            const u16 block = LittleEndian::convertTo<u16>(delta.data() + ofs);
+            const u32 pos   = LittleEndian::convertTo<u32>(delta.data() + ofs + 2);
+            const u32 size  = LittleEndian::convertTo<u32>(delta.data() + ofs + 6);
+            if (block >= blocks.size() || pos > blocks[block].length ||
+                blocks[block].length - pos < size || delta.size() - ofs - DELTA_RECORD < size)
+            {
+                return false;
+            }
+            ofs += DELTA_RECORD + size;
+        }
+        if (ofs != delta.size())
+        {
+            return false;
+        }
+
+        ofs = DELTA_HEADER;
+        for (u32 i = 0; i < count; i++)
+        {
+            const u16 block = LittleEndian::convertTo<u16>(delta.data() + ofs);
+            const u32 pos   = LittleEndian::convertTo<u32>(delta.data() + ofs + 2);
+            const u32 size  = LittleEndian::convertTo<u32>(delta.data() + ofs + 6);
+            const u8* start = delta.data() + ofs + DELTA_RECORD;
+            std::copy(start, start + size, &data[blocks[block].offset + pos]);
+            ofs += DELTA_RECORD + size;
+        }
+        blocksRewritten();
+
+        return true;
+    }
 }
@@ -27,11 +27,13 @@
 #include "sav/Sav1.hpp"
 #include "pkx/PK1.hpp"
 #include "pkx/PKX.hpp"
+#include "sav/ItemTable.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/flagUtil.hpp"
 #include "utils/i18n.hpp"
 #include "utils/utils.hpp"
+#include "utils/ValueConverter.hpp"
 #include "wcx/WCX.hpp"
 #include <algorithm>
 #include <limits>
@@ -70,13 +72,6 @@ namespace pksm
 
         originalCurrentBox = currentBox();
     }
-    Sav::Game Sav1::getVersion(const std::shared_ptr<u8[]>& dt)
-    {
-        // for now it doesn't matter, the only difference is Pikachu's friendship and Pikachu surf
-        // score
-        return Game::RGB;
-    }
-
     // max length of string + terminator
     u8 Sav1::nameLength() const
     {
@@ -88,32 +83,45 @@ namespace pksm
         return japanese ? PK1::JP_LENGTH_WITH_NAMES : PK1::INT_LENGTH_WITH_NAMES;
     }
 
-    // ctrl-v the fixparty code, boxes are expected to be contiguous
+    // boxes are expected to be contiguous
     void Sav1::fixBoxes()
     {
-        // Poor man's bubble sort-like thing
         for (int i = 0; i < maxBoxes(); i++)
         {
-            int numPkm = maxPkmInBox;
-            for (int j = maxPkmInBox - 1; j > 0; j--)
+            fixBox(i);
+        }
+    }
+
+    u8 Sav1::compactSlots(u32 listOfs, u32 recordOfs, u32 recordLength, u32 otNameOfs,
+        u32 nicknameOfs, u8 count, u8 capacity)
+    {
+        // slots past the count are empty no matter what they contain
+        count     = std::min(count, capacity);
+        u8 filled = 0;
+        for (u8 slot = 0; slot < count; slot++)
+        {
+            u8* record = &data[recordOfs + slot * recordLength];
+            if (SpeciesConverter::g1ToNational(record[0]) == Species::None)
             {
-                auto checkPKM = pkm(i, j);
-                if (checkPKM->species() == Species::None)
-                {
-                    numPkm--;
-                    continue;
-                }
-                auto prevPKM = pkm(i, j - 1);
-                if (checkPKM->species() != Species::None && prevPKM->species() == Species::None)
-                {
-                    pkm(*checkPKM, i, j - 1, false);
-                    pkm(*prevPKM, i, j, false);
-                    numPkm = maxPkmInBox;
-                    j      = maxPkmInBox; // reset loop
-                }
+                continue;
             }
-            fixBox(i);
+            if (slot != filled)
+            {
+                std::swap_ranges(
+                    record, record + recordLength, &data[recordOfs + filled * recordLength]);
+                std::swap_ranges(&data[otNameOfs + slot * nameLength()],
+                    &data[otNameOfs + (slot + 1) * nameLength()],
+                    &data[otNameOfs + filled * nameLength()]);
+                std::swap_ranges(&data[nicknameOfs + slot * nameLength()],
+                    &data[nicknameOfs + (slot + 1) * nameLength()],
+                    &data[nicknameOfs + filled * nameLength()]);
+            }
+            // sets the species1 in a list that the game uses for speed
+            data[listOfs + filled] = data[recordOfs + filled * recordLength];
+            filled++;
         }
+        data[listOfs + filled] = 0xFF;
+        return filled;
     }
 
     void Sav1::finishEditing()
@@ -502,27 +510,13 @@ namespace pksm
     }
     void Sav1::fixBox(u8 box)
     {
-        u8 count = 0;
-        while (pkm(box, count)->species() != Species::None)
-        {
-            // sets the species1 in a list that the game uses for speed
-            data[boxStart(box) + 1 + count] = data[boxOffset(box, count)];
-            count++;
-        }
-        data[boxStart(box) + 1 + count] = 0xFF;
-        data[boxStart(box)]             = count;
+        data[boxStart(box)] = compactSlots(boxStart(box) + 1, boxOffset(box, 0), PK1::BOX_LENGTH,
+            boxOtNameOffset(box, 0), boxNicknameOffset(box, 0), boxCount(box), maxPkmInBox);
     }
     void Sav1::fixParty()
     {
-        Sav::fixParty();
-        u8 count = 0;
-        while (pkm(count)->species() != Species::None && count < 6)
-        {
-            data[OFS_PARTY + 1 + count] = data[partyOffset(count)];
-            count++;
-        }
-        data[OFS_PARTY + 1 + count] = 0xFF;
-        data[OFS_PARTY]             = count;
+        data[OFS_PARTY] = compactSlots(OFS_PARTY + 1, partyOffset(0), PK1::PARTY_LENGTH,
+            partyOtNameOffset(0), partyNicknameOffset(0), partyCount(), 6);
     }
 
     int Sav1::maxSlot() const
@@ -592,22 +586,20 @@ namespace pksm
             items[Pouch::NormalItem].end());
         return items;
     }
-    std::map<Sav::Pouch, std::vector<int>> Sav1::validItems() const
-    {
-        std::map<Sav::Pouch, std::vector<int>> items = {
-            {Pouch::NormalItem,
-                {0, 1, 2, 3, 4, 442, 450, 81, 18, 19, 20, 21, 22, 23, 24, 25, 26, 17, 78, 79, 103,
-                    82, 83, 84, 45, 46, 47, 48, 49, 50, 102, 101, 872, 60, 85, 876, 92, 63, 27, 28,
-                    29, 55, 76, 77, 56, 30, 31, 32, 873, 877, 57, 58, 59, 61, 444, 875, 471, 874,
-                    651, 878, 216, 445, 446, 447, 51, 38, 39, 40, 41, 420, 421, 422, 423, 424, 328,
-                    329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
-                    345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
-                    361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
-                    377}},
-            {Pouch::PCItem, {}}};
-        items[Pouch::PCItem].insert(items[Pouch::PCItem].end(), items[Pouch::NormalItem].begin(),
-            items[Pouch::NormalItem].end());
-        return items;
+    const ItemTable& Sav1::itemTable() const
+    {
+        static constexpr auto items = makeItemTableWithPC(
+            PouchItems{Pouch::NormalItem,
+                std::to_array<u16>({0, 1, 2, 3, 4, 442, 450, 81, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+                    17, 78, 79, 103, 82, 83, 84, 45, 46, 47, 48, 49, 50, 102, 101, 872, 60, 85, 876,
+                    92, 63, 27, 28, 29, 55, 76, 77, 56, 30, 31, 32, 873, 877, 57, 58, 59, 61, 444,
+                    875, 471, 874, 651, 878, 216, 445, 446, 447, 51, 38, 39, 40, 41, 420, 421, 422,
+                    423, 424, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341,
+                    342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357,
+                    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+                    374, 375, 376, 377})});
+        static constexpr ItemTable table = items.view();
+        return table;
     }
     void Sav1::fixItemLists()
     {
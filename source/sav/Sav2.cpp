@@ -27,6 +27,7 @@
 #include "sav/Sav2.hpp"
 #include "pkx/PK2.hpp"
 #include "pkx/PKX.hpp"
+#include "sav/ItemTable.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/flagUtil.hpp"
@@ -34,9 +35,47 @@
 #include "utils/utils.hpp"
 #include "wcx/WCX.hpp"
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <stdlib.h>
 
+namespace
+{
+    // Internal IDs of the TMs and HMs, in the order the TM pouch stores their counts
+    constexpr std::array<u8, 57> TM_POUCH_IDS = {191, 192, 193, 194, 196, 197, 198, 199, 200, 201,
+        202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
+        221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+        239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249};
+
+    constexpr std::array<u16, 57> GS_TMS = {328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338,
+        339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+        357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+        375, 376, 377, 420, 421, 422, 423, 424, 425, 426};
+
+    constexpr std::array<u16, 115> GS_ITEMS = {213, 81, 18, 19, 20, 21, 22, 23, 24, 25, 26, 17, 78,
+        79, 41, 82, 83, 84, 45, 46, 47, 48, 256, 49, 50, 60, 85, 257, 92, 63, 27, 28, 29, 55, 76,
+        77, 56, 30, 31, 32, 57, 58, 59, 61, 216, 891, 51, 38, 39, 40, 33, 217, 151, 890, 237, 244,
+        149, 153, 152, 245, 221, 156, 150, 485, 86, 87, 222, 487, 223, 486, 488, 224, 243, 248,
+        490, 241, 491, 489, 240, 473, 259, 228, 246, 242, 157, 88, 89, 229, 247, 504, 239, 258,
+        230, 34, 35, 36, 37, 238, 231, 90, 91, 249, 43, 232, 233, 250, 234, 154, 235, 44, 236, 80,
+        252, 155, 158};
+
+    constexpr std::array<u16, 17> GS_KEY_ITEMS = {
+        450, 444, 445, 446, 447, 478, 464, 456, 484, 482, 475, 481, 479, 476, 480, 477, 483};
+
+    constexpr std::array<u16, 11> GS_BALLS = {1, 2, 3, 4, 495, 493, 494, 492, 497, 498, 496};
+
+    // Crystal added two key items
+    constexpr auto CRYSTAL_KEY_ITEMS = []
+    {
+        std::array<u16, GS_KEY_ITEMS.size() + 2> ret{};
+        std::copy(GS_KEY_ITEMS.begin(), GS_KEY_ITEMS.end(), ret.begin());
+        ret[GS_KEY_ITEMS.size()]     = 474;
+        ret[GS_KEY_ITEMS.size() + 1] = 472;
+        return ret;
+    }();
+}
+
 namespace pksm
 {
     // the language class and version necessarily need to be found, may as well use them
@@ -175,55 +214,6 @@ namespace pksm
             lang = StringUtils::guessLanguage12(otName());
     }
 
-    std::tuple<GameVersion, Language, bool> Sav2::getVersion(const std::shared_ptr<u8[]>& dt)
-    {
-        GameVersion returnVersion = GameVersion::INVALID;
-        Language returnLanguage   = Language::None;
-        bool saveFound            = false;
-
-        if (validList(dt, 0x288A, 20) && validList(dt, 0x2D6C, 20))
-        {
-            returnVersion  = GameVersion::GD;
-            returnLanguage = Language::ENG; // as well as all other languages not enumerated
-            saveFound      = true;
-        }
-        else if (validList(dt, 0x2865, 20) && validList(dt, 0x2D10, 20))
-        {
-            returnVersion  = GameVersion::C;
-            returnLanguage = Language::ENG;
-            saveFound      = true;
-        }
-        else if (validList(dt, 0x2D10, 30))
-        {
-            if (validList(dt, 0x283E, 30))
-            {
-                returnVersion  = GameVersion::GD;
-                returnLanguage = Language::JPN;
-                saveFound      = true;
-            }
-            else if (validList(dt, 0x281A, 30))
-            {
-                returnVersion  = GameVersion::C;
-                returnLanguage = Language::JPN;
-                saveFound      = true;
-            }
-        }
-        else if (validList(dt, 0x28CC, 20) && validList(dt, 0x2DAE, 20))
-        {
-            returnVersion  = GameVersion::GD;
-            returnLanguage = Language::KOR;
-            saveFound      = true;
-        }
-        // there is no KOR crystal
-
-        return {returnVersion, returnLanguage, saveFound};
-    }
-
-    bool Sav2::validList(const std::shared_ptr<u8[]>& dt, size_t ofs, u8 slot)
-    {
-        return (dt[ofs] <= 30) && (dt[ofs + 1 + dt[ofs]] == 0xFF);
-    }
-
     // max length of string + terminator
     u8 Sav2::nameLength() const
     {
@@ -235,31 +225,52 @@ namespace pksm
         return japanese ? PK2::JP_LENGTH_WITH_NAMES : PK2::INT_LENGTH_WITH_NAMES;
     }
 
+    // boxes are expected to be contiguous
     void Sav2::fixBoxes()
     {
-        // Poor man's bubble sort-like thing
         for (int i = 0; i < maxBoxes(); i++)
         {
-            int numPkm = maxPkmInBox;
-            for (int j = maxPkmInBox - 1; j > 0; j--)
+            fixBox(i);
+        }
+    }
+
+    u8 Sav2::compactSlots(u32 listOfs, u32 recordOfs, u32 recordLength, u32 otNameOfs,
+        u32 nicknameOfs, u8 count, u8 capacity)
+    {
+        // slots past the count are empty no matter what they contain
+        count     = std::min(count, capacity);
+        u8 filled = 0;
+        for (u8 slot = 0; slot < count; slot++)
+        {
+            u8* record = &data[recordOfs + slot * recordLength];
+            if (record[0] == 0)
             {
-                auto checkPKM = pkm(i, j);
-                if (checkPKM->species() == Species::None)
-                {
-                    numPkm--;
-                    continue;
-                }
-                auto prevPKM = pkm(i, j - 1);
-                if (checkPKM->species() != Species::None && prevPKM->species() == Species::None)
-                {
-                    pkm(*checkPKM, i, j - 1, false);
-                    pkm(*prevPKM, i, j, false);
-                    numPkm = maxPkmInBox;
-                    j      = maxPkmInBox; // reset loop
-                }
+                continue;
             }
-            fixBox(i);
+            if (slot != filled)
+            {
+                std::swap_ranges(
+                    record, record + recordLength, &data[recordOfs + filled * recordLength]);
+                std::swap_ranges(&data[otNameOfs + slot * nameLength()],
+                    &data[otNameOfs + (slot + 1) * nameLength()],
+                    &data[otNameOfs + filled * nameLength()]);
+                std::swap_ranges(&data[nicknameOfs + slot * nameLength()],
+                    &data[nicknameOfs + (slot + 1) * nameLength()],
+                    &data[nicknameOfs + filled * nameLength()]);
+            }
+            // the list marks eggs with 0xFD rather than their species
+            if (data[listOfs + slot] != 0xFD)
+            {
+                data[listOfs + filled] = data[recordOfs + filled * recordLength];
+            }
+            else
+            {
+                data[listOfs + filled] = 0xFD;
+            }
+            filled++;
         }
+        data[listOfs + filled] = 0xFF;
+        return filled;
     }
 
     void Sav2::finishEditing()
@@ -737,48 +748,13 @@ namespace pksm
     }
     void Sav2::fixBox(u8 box)
     {
-        u8 count = 0;
-        while (count < maxPkmInBox)
-        {
-            if (pkm(box, count)->species() == Species::None)
-                break;
-
-            if (pkm(box, count)->egg())
-            {
-                data[boxStart(box) + 1 + count] = 0xFD;
-            }
-            else
-            {
-                data[boxStart(box) + 1 + count] = data[boxOffset(box, count)];
-            }
-
-            count++;
-        }
-        data[boxStart(box) + 1 + count] = 0xFF;
-        data[boxStart(box)]             = count;
+        data[boxStart(box)] = compactSlots(boxStart(box) + 1, boxOffset(box, 0), PK2::BOX_LENGTH,
+            boxOtNameOffset(box, 0), boxNicknameOffset(box, 0), boxCount(box), maxPkmInBox);
     }
     void Sav2::fixParty()
     {
-        Sav::fixParty();
-        u8 count = 0;
-        while (count < 6)
-        {
-            if (pkm(count)->species() == Species::None)
-                break;
-
-            if (pkm(count)->egg())
-            {
-                data[OFS_PARTY + 1 + count] = 0xFD;
-            }
-            else
-            {
-                data[OFS_PARTY + 1 + count] = data[partyOffset(count)];
-            }
-
-            count++;
-        }
-        data[OFS_PARTY + 1 + count] = 0xFF;
-        data[OFS_PARTY]             = count;
+        data[OFS_PARTY] = compactSlots(OFS_PARTY + 1, partyOffset(0), PK2::PARTY_LENGTH,
+            partyOtNameOffset(0), partyNicknameOffset(0), partyCount(), 6);
     }
 
     int Sav2::maxSlot() const
@@ -799,14 +775,17 @@ namespace pksm
         }
         Item2 item = static_cast<Item2>(tItem);
         auto write = item.bytes();
-        int index  = 0; // for TMs
         switch (pouch)
         {
             case Pouch::TM:
-                while (validItems2()[Pouch::TM][index] != write[0])
-                    index++;
-                data[OFS_TM_POUCH + index] = write[1];
+            {
+                auto found = std::find(TM_POUCH_IDS.begin(), TM_POUCH_IDS.end(), write[0]);
+                if (found != TM_POUCH_IDS.end())
+                {
+                    data[OFS_TM_POUCH + (found - TM_POUCH_IDS.begin())] = write[1];
+                }
                 break;
+            }
             case Pouch::NormalItem:
                 std::copy(write.begin(), write.end(), &data[OFS_ITEMS + 1 + (slot * 2)]);
                 break;
@@ -835,7 +814,11 @@ namespace pksm
         {
             case Pouch::TM:
                 // apparently they store the counts of the TMs
-                itemData[0] = validItems2()[Pouch::TM][slot];
+                if (slot >= TM_POUCH_IDS.size())
+                {
+                    return std::make_unique<Item2>(nullptr);
+                }
+                itemData[0] = TM_POUCH_IDS[slot];
                 itemData[1] = data[OFS_TM_POUCH + slot];
                 returnVal   = std::make_unique<Item2>(itemData.data());
                 break;
@@ -866,81 +849,17 @@ namespace pksm
         return {{Pouch::TM, 57}, {Pouch::NormalItem, 20}, {Pouch::KeyItem, 26}, {Pouch::Ball, 12},
             {Pouch::PCItem, 50}};
     }
-    std::map<Sav::Pouch, std::vector<int>> Sav2::validItems2() const
-    {
-        std::map<Sav::Pouch, std::vector<int>> items = {
-            {Pouch::TM, {191, 192, 193, 194, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
-                            207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 221,
-                            222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
-                            236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249}},
-            {Pouch::NormalItem,
-                {3, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 26, 27, 28,
-                    29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 46, 47, 48, 49,
-                    51, 52, 53, 57, 60, 62, 63, 64, 65, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
-                    83, 84, 85, 86, 87, 88, 89, 91, 92, 93, 94, 95, 96, 97, 98, 99, 101, 102, 103,
-                    104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 117, 118, 119, 121, 122,
-                    123, 124, 125, 126, 131, 132, 138, 139, 140, 143, 144, 146, 150, 151, 152, 156,
-                    158, 163, 167, 168, 169, 170, 172, 173, 174, 180, 181, 182, 183, 184, 185, 186,
-                    187, 188, 189}},
-            {Pouch::KeyItem,
-                {7, 54, 55, 58, 59, 61, 66, 67, 68, 69, 71, 127, 128, 130, 133, 134, 175, 178}},
-            {Pouch::Ball, {1, 2, 4, 5, 157, 159, 160, 161, 164, 165, 166}}, {Pouch::PCItem, {}}};
-
-        // Crystal added four key items
-        if (version() == GameVersion::C)
-        {
-            std::vector<int> crystalKey = {70, 115, 116, 129};
-            items[Pouch::KeyItem].insert(
-                items[Pouch::KeyItem].end(), crystalKey.begin(), crystalKey.end());
-        }
-
-        // PC can hold any item
-        items[Pouch::PCItem].insert(
-            items[Pouch::PCItem].end(), items[Pouch::TM].begin(), items[Pouch::TM].end());
-        items[Pouch::PCItem].insert(items[Pouch::PCItem].end(), items[Pouch::NormalItem].begin(),
-            items[Pouch::NormalItem].end());
-        items[Pouch::PCItem].insert(
-            items[Pouch::PCItem].end(), items[Pouch::KeyItem].begin(), items[Pouch::KeyItem].end());
-        items[Pouch::PCItem].insert(
-            items[Pouch::PCItem].end(), items[Pouch::Ball].begin(), items[Pouch::Ball].end());
-
-        return items;
-    }
-    std::map<Sav::Pouch, std::vector<int>> Sav2::validItems() const
-    {
-        std::map<Sav::Pouch, std::vector<int>> items = {
-            {Pouch::TM, {328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342,
-                            343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
-                            357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370,
-                            371, 372, 373, 374, 375, 376, 377, 420, 421, 422, 423, 424, 425, 426}},
-            {Pouch::NormalItem,
-                {213, 81, 18, 19, 20, 21, 22, 23, 24, 25, 26, 17, 78, 79, 41, 82, 83, 84, 45, 46,
-                    47, 48, 256, 49, 50, 60, 85, 257, 92, 63, 27, 28, 29, 55, 76, 77, 56, 30, 31,
-                    32, 57, 58, 59, 61, 216, 891, 51, 38, 39, 40, 33, 217, 151, 890, 237, 244, 149,
-                    153, 152, 245, 221, 156, 150, 485, 86, 87, 222, 487, 223, 486, 488, 224, 243,
-                    248, 490, 241, 491, 489, 240, 473, 259, 228, 246, 242, 157, 88, 89, 229, 247,
-                    504, 239, 258, 230, 34, 35, 36, 37, 238, 231, 90, 91, 249, 43, 232, 233, 250,
-                    234, 154, 235, 44, 236, 80, 252, 155, 158}},
-            {Pouch::KeyItem, {450, 444, 445, 446, 447, 478, 464, 456, 484, 482, 475, 481, 479, 476,
-                                 480, 477, 483}},
-            {Pouch::Ball, {1, 2, 3, 4, 495, 493, 494, 492, 497, 498, 496}}, {Pouch::PCItem, {}}};
-
-        if (version() == GameVersion::C)
-        {
-            std::vector<int> crystalKey = {474, 472};
-            items[Pouch::KeyItem].insert(
-                items[Pouch::KeyItem].end(), crystalKey.begin(), crystalKey.end());
-        }
-
-        items[Pouch::PCItem].insert(
-            items[Pouch::PCItem].end(), items[Pouch::TM].begin(), items[Pouch::TM].end());
-        items[Pouch::PCItem].insert(items[Pouch::PCItem].end(), items[Pouch::NormalItem].begin(),
-            items[Pouch::NormalItem].end());
-        items[Pouch::PCItem].insert(
-            items[Pouch::PCItem].end(), items[Pouch::KeyItem].begin(), items[Pouch::KeyItem].end());
-        items[Pouch::PCItem].insert(
-            items[Pouch::PCItem].end(), items[Pouch::Ball].begin(), items[Pouch::Ball].end());
-        return items;
+    const ItemTable& Sav2::itemTable() const
+    {
+        static constexpr auto goldSilver = makeItemTableWithPC(PouchItems{Pouch::TM, GS_TMS},
+            PouchItems{Pouch::NormalItem, GS_ITEMS}, PouchItems{Pouch::KeyItem, GS_KEY_ITEMS},
+            PouchItems{Pouch::Ball, GS_BALLS});
+        static constexpr auto crystal = makeItemTableWithPC(PouchItems{Pouch::TM, GS_TMS},
+            PouchItems{Pouch::NormalItem, GS_ITEMS}, PouchItems{Pouch::KeyItem, CRYSTAL_KEY_ITEMS},
+            PouchItems{Pouch::Ball, GS_BALLS});
+        static constexpr ItemTable goldSilverTable = goldSilver.view();
+        static constexpr ItemTable crystalTable    = crystal.view();
+        return version() == GameVersion::C ? crystalTable : goldSilverTable;
     }
 
     u8 Sav2::pouchEntryCount(Pouch pouch) const
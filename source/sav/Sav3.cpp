@@ -55,6 +55,59 @@ namespace pksm
         }
     }
 
+    void Sav3::loadPC(u16 pcBlocks)
+    {
+        if (!pcData)
+        {
+            pcData = std::unique_ptr<u8[]>(new u8[SIZE_PC]);
+        }
+        for (int i = 0; i < PC_BLOCK_COUNT; i++)
+        {
+            if (!(pcBlocks & (1 << i)))
+            {
+                continue;
+            }
+            int ofs = blockOfs[PC_BLOCK_START + i];
+            u8* out = &pcData[i * SIZE_BLOCK_USED];
+            // early saves may not have every block initialized yet
+            if (ofs < 0)
+            {
+                std::fill_n(out, chunkLength[PC_BLOCK_START + i], 0);
+            }
+            else
+            {
+                std::copy_n(&data[ofs], chunkLength[PC_BLOCK_START + i], out);
+            }
+        }
+        dirtyPCBlocks &= ~pcBlocks;
+        rawPCBlocks &= ~pcBlocks;
+    }
+
+    u16 Sav3::storePC()
+    {
+        u16 stored = 0;
+        for (int i = 0; i < PC_BLOCK_COUNT; i++)
+        {
+            int ofs = blockOfs[PC_BLOCK_START + i];
+            if ((dirtyPCBlocks & (1 << i)) && ofs >= 0)
+            {
+                std::copy_n(
+                    &pcData[i * SIZE_BLOCK_USED], chunkLength[PC_BLOCK_START + i], &data[ofs]);
+                stored |= 1 << i;
+            }
+        }
+        dirtyPCBlocks = 0;
+        return stored;
+    }
+
+    void Sav3::markPCDirty(int ofs, int length)
+    {
+        for (int i = ofs / SIZE_BLOCK_USED; i <= (ofs + length - 1) / SIZE_BLOCK_USED; i++)
+        {
+            dirtyPCBlocks |= 1 << i;
+        }
+    }
+
     std::array<int, Sav3::BLOCK_COUNT> Sav3::getBlockOrder(const std::shared_ptr<u8[]>& dt, int ofs)
     {
         std::array<int, BLOCK_COUNT> order;
@@ -77,44 +130,11 @@ namespace pksm
         return count1 > count2 ? 0 : 1;
     }
 
-    Sav::Game Sav3::getVersion(const std::shared_ptr<u8[]>& dt)
-    {
-        // Get block 0 offset
-        std::array<int, BLOCK_COUNT> o1     = getBlockOrder(dt, 0);
-        std::array<int, BLOCK_COUNT> o2     = getBlockOrder(dt, BLOCK_COUNT * SIZE_BLOCK);
-        int activeSAV                       = getActiveSaveIndex(dt, o1, o2);
-        std::array<int, BLOCK_COUNT>& order = activeSAV == 0 ? o1 : o2;
-
-        int ABO = activeSAV * SIZE_BLOCK * BLOCK_COUNT;
-
-        int blockOfs0 =
-            ((std::find(order.begin(), order.end(), 0) - order.begin()) * SIZE_BLOCK) + ABO;
-
-        // Get version
-        u32 gameCode = LittleEndian::convertTo<u32>(&dt[blockOfs0 + 0xAC]);
-        switch (gameCode)
-        {
-            case 1:
-                return Game::FRLG; // fixed value
-            case 0:
-                return Game::RS; // no battle tower record data
-            default:
-                // Ruby doesn't set data as far down as Emerald.
-                // 00 FF 00 00 00 00 00 00 00 FF 00 00 00 00 00 00
-                // ^ byte pattern in Emerald saves, is all zero in Ruby/Sapphire as far as I can
-                // tell. Some saves have had data @ 0x550
-                if (LittleEndian::convertTo<u64>(&dt[blockOfs0 + 0xEE0]) != 0)
-                    return Game::E;
-                if (LittleEndian::convertTo<u64>(&dt[blockOfs0 + 0xEE8]) != 0)
-                    return Game::E;
-                return Game::RS;
-        }
-    }
-
     Sav3::Sav3(const std::shared_ptr<u8[]>& dt, const std::vector<int>& flagOffsets)
         : Sav(dt, 0x20000), seenFlagOffsets(flagOffsets)
     {
         loadBlocks();
+        loadPC();
 
         // Japanese games are limited to 5 character OT names; any unused characters are 0xFF.
         // 5 for JP, 7 for INT. There's always 1 terminator, thus we can check 0x6-0x7 being 0xFFFF
@@ -150,7 +170,42 @@ namespace pksm
         return sum + (sum >> 16);
     }
 
+    u8* Sav3::getBlock(size_t blockNum)
+    {
+        if (blockNum >= PC_BLOCK_START)
+        {
+            // Write pending box edits out first so the caller sees them, and re-sign the block
+            // (and reread it into the PC buffer) on the next finishEditing
+            u16 bit = 1 << (blockNum - PC_BLOCK_START);
+            int ofs = blockOfs[blockNum];
+            if ((dirtyPCBlocks & bit) && ofs >= 0)
+            {
+                std::copy_n(&pcData[(blockNum - PC_BLOCK_START) * SIZE_BLOCK_USED],
+                    chunkLength[blockNum], &data[ofs]);
+                dirtyPCBlocks &= ~bit;
+            }
+            rawPCBlocks |= bit;
+        }
+        return &data[blockOfs[blockNum]];
+    }
+
     void Sav3::resign(void)
+    {
+        storePC();
+        // The raw image may have been written through rawData(), so it wins over the PC buffer
+        loadPC();
+        resignBlocks((1 << PC_BLOCK_COUNT) - 1);
+    }
+
+    void Sav3::finishEditing(void)
+    {
+        u16 raw    = rawPCBlocks;
+        u16 stored = storePC();
+        loadPC(raw);
+        resignBlocks(stored | raw);
+    }
+
+    void Sav3::resignBlocks(u16 pcBlocks)
     {
         for (int i = 0; i < BLOCK_COUNT; i++)
         {
@@ -158,6 +213,9 @@ namespace pksm
             int index = blockOrder[i];
             if (index == -1)
                 continue;
+            // Untouched PC blocks still have valid checksums
+            if (index >= PC_BLOCK_START && !(pcBlocks & (1 << (index - PC_BLOCK_START))))
+                continue;
             u16 chk = calculateChecksum({&data[ofs], chunkLength[index]});
             LittleEndian::convertFrom<u16>(&data[ofs + 0xFF6], chk);
         }
@@ -173,6 +231,32 @@ namespace pksm
         }
     }
 
+    std::vector<Sav::BlockRange> Sav3::blockMap(void) const
+    {
+        std::vector<BlockRange> ret;
+        for (int i = 0; i < BLOCK_COUNT; i++)
+        {
+            if (blockOfs[i] < 0)
+            {
+                ret.push_back({0, 0});
+            }
+            else
+            {
+                ret.push_back({u32(blockOfs[i]), chunkLength[i]});
+            }
+        }
+        ret.push_back({0x1C000, SIZE_BLOCK_USED});
+        ret.push_back({0x1D000, SIZE_BLOCK_USED});
+        return ret;
+    }
+
+    void Sav3::blocksRewritten(void)
+    {
+        // The PC buffer would otherwise write its stale copy back over the new blocks
+        loadPC();
+        resign();
+    }
+
     u32 Sav3::securityKey(void) const
     {
         switch (game)
@@ -376,11 +460,12 @@ namespace pksm
 
     u8 Sav3::currentBox(void) const
     {
-        return data[blockOfs[5]];
+        return pcData[0];
     }
     void Sav3::currentBox(u8 v)
     {
-        data[blockOfs[5]] = v;
+        pcData[0] = v;
+        markPCDirty(0, 1);
     }
 
     u32 Sav3::boxOffset(u8 box, u8 slot) const
@@ -403,21 +488,12 @@ namespace pksm
     }
     std::unique_ptr<PKX> Sav3::pkm(u8 box, u8 slot) const
     {
-        u32 offset = boxOffset(box, slot);
-        // Is it split?
-        if ((offset % 0x1000) + PK3::BOX_LENGTH > 0xF80)
-        {
-            // Concatenate the data if so
-            u8 pkmData[PK3::BOX_LENGTH];
-            auto nextOut = std::copy(&data[offset], &data[(offset & 0xFFFFF000) | 0xF80], pkmData);
-            u32 nextOffset = boxOffset(box + (slot + 1) / 30, (slot + 1) % 30);
-            std::copy(&data[nextOffset & 0xFFFFF000], &data[nextOffset], nextOut);
-            return PKX::getPKM<Generation::THREE>(pkmData, PK3::BOX_LENGTH);
-        }
-        else
-        {
-            return PKX::getPKM<Generation::THREE>(&data[offset], PK3::BOX_LENGTH);
-        }
+        return PKX::getPKM<Generation::THREE>(&pcData[pcOffset(box, slot)], PK3::BOX_LENGTH);
+    }
+
+    std::span<const u8> Sav3::boxSlotData(u8 box, u8 slot) const
+    {
+        return {&pcData[pcOffset(box, slot)], PK3::BOX_LENGTH};
     }
 
     void Sav3::pkm(const PKX& pk, u8 slot)
@@ -439,21 +515,9 @@ namespace pksm
                 trade(*pk3);
             }
 
-            u32 offset = boxOffset(box, slot);
-            // Is it split?
-            if ((offset % 0x1000) + PK3::BOX_LENGTH > 0xF80)
-            {
-                // Copy into the correct positions if so
-                u32 firstSize = 0xF80 - (offset % 0x1000);
-                std::ranges::copy(pk3->rawData().subspan(0, firstSize), &data[offset]);
-                u32 nextOffset = boxOffset(box + (slot + 1) / 30, (slot + 1) % 30);
-                std::ranges::copy(pk3->rawData().subspan(firstSize, PK3::BOX_LENGTH - firstSize),
-                    &data[nextOffset & 0xFFFFF000]);
-            }
-            else
-            {
-                std::ranges::copy(pk3->rawData(), &data[offset]);
-            }
+            int offset = pcOffset(box, slot);
+            std::ranges::copy(pk3->rawData(), &pcData[offset]);
+            markPCDirty(offset, PK3::BOX_LENGTH);
         }
     }
 
@@ -569,57 +633,36 @@ namespace pksm
 
     void Sav3::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
+        for (int offset = pcOffset(0, 0); offset < pcOffset(maxBoxes(), 0);
+             offset += PK3::BOX_LENGTH)
         {
-            for (u8 slot = 0; slot < 30; slot++)
+            auto pk3 = PKX::getPKM<Generation::THREE>(&pcData[offset], PK3::BOX_LENGTH, true);
+            if (!crypted)
             {
-                u32 offset = boxOffset(box, slot);
-                bool split = (offset % 0x1000) + PK3::BOX_LENGTH > 0xF80;
-                // If it's split, it needs to get fully copied out and re-set in
-                // Otherwise, use the direct-modification constructor
-                std::unique_ptr<PKX> pk3;
-                if (split)
-                {
-                    pk3 = pkm(box, slot);
-                }
-                else
-                {
-                    pk3 = PKX::getPKM<Generation::THREE>(&data[offset], PK3::BOX_LENGTH, true);
-                }
-                if (!crypted)
-                {
-                    pk3->encrypt();
-                }
-                if (split)
-                {
-                    pkm(*pk3, box, slot, false);
-                }
+                pk3->encrypt();
             }
         }
+        markPCDirty(pcOffset(0, 0), pcOffset(maxBoxes(), 0) - pcOffset(0, 0));
     }
 
     std::string Sav3::boxName(u8 box) const
     {
-        return StringUtils::getString3(
-            data.get(), boxOffset(maxBoxes(), 0) + (box * 9), 9, japanese);
+        return StringUtils::getString3(pcData.get(), boxNameOffset(box), 9, japanese);
     }
     void Sav3::boxName(u8 box, const std::string_view& v)
     {
-        return StringUtils::setString3(
-            data.get(), v, boxOffset(maxBoxes(), 0) + (box * 9), 8, japanese, 9);
+        StringUtils::setString3(pcData.get(), v, boxNameOffset(box), 8, japanese, 9);
+        markPCDirty(boxNameOffset(box), 9);
     }
 
     u8 Sav3::boxWallpaper(u8 box) const
     {
-        int offset = boxOffset(maxBoxes(), 0);
-        offset += (maxBoxes() * 0x9) + box;
-        return data[offset];
+        return pcData[boxNameOffset(maxBoxes()) + box];
     }
     void Sav3::boxWallpaper(u8 box, u8 v)
     {
-        int offset = boxOffset(maxBoxes(), 0);
-        offset += (maxBoxes() * 0x9) + box;
-        data[offset] = v;
+        pcData[boxNameOffset(maxBoxes()) + box] = v;
+        markPCDirty(boxNameOffset(maxBoxes()) + box, 1);
     }
 
     u8 Sav3::partyCount(void) const
@@ -631,61 +674,67 @@ namespace pksm
         data[blockOfs[1] + (game == Game::FRLG ? 0x34 : 0x234)] = v;
     }
 
-    void Sav3::item(const Item& tItem, Pouch pouch, u16 slot)
+    u8* Sav3::pouchStart(Pouch pouch) const
     {
-        Item3 item = static_cast<Item3>(tItem);
-        if (pouch == Pouch::PCItem)
-        {
-            item.securityKey(0);
-        }
-        else
-        {
-            item.securityKey(securityKey());
-        }
-        auto write = item.bytes();
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchHeldItem + (slot * 4)]);
-                break;
+                return &data[OFS_PouchHeldItem];
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchKeyItem + (slot * 4)]);
-                break;
+                return &data[OFS_PouchKeyItem];
             case Pouch::Ball:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchBalls + (slot * 4)]);
-                break;
+                return &data[OFS_PouchBalls];
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchTMHM + (slot * 4)]);
-                break;
+                return &data[OFS_PouchTMHM];
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[OFS_PouchBerry + (slot * 4)]);
-                break;
+                return &data[OFS_PouchBerry];
             case Pouch::PCItem:
-                std::copy(write.begin(), write.end(), &data[OFS_PCItem + (slot * 4)]);
-                break;
+                return &data[OFS_PCItem];
             default:
-                return;
+                return nullptr;
+        }
+    }
+    u16 Sav3::pouchKey(Pouch pouch) const
+    {
+        // The PC's counts are not obfuscated
+        return pouch == Pouch::PCItem ? 0 : securityKey();
+    }
+    void Sav3::item(const Item& tItem, Pouch pouch, u16 slot)
+    {
+        if (u8* slots = pouchStart(pouch))
+        {
+            Item3 item = static_cast<Item3>(tItem);
+            item.securityKey(pouchKey(pouch));
+            item.write(slots + slot * 4);
         }
     }
     std::unique_ptr<Item> Sav3::item(Pouch pouch, u16 slot) const
     {
-        switch (pouch)
+        if (u8* slots = pouchStart(pouch))
         {
-            case Pouch::NormalItem:
-                return std::make_unique<Item3>(
-                    &data[OFS_PouchHeldItem + (slot * 4)], securityKey());
-            case Pouch::KeyItem:
-                return std::make_unique<Item3>(&data[OFS_PouchKeyItem + (slot * 4)], securityKey());
-            case Pouch::Ball:
-                return std::make_unique<Item3>(&data[OFS_PouchBalls + (slot * 4)], securityKey());
-            case Pouch::TM:
-                return std::make_unique<Item3>(&data[OFS_PouchTMHM + (slot * 4)], securityKey());
-            case Pouch::Berry:
-                return std::make_unique<Item3>(&data[OFS_PouchBerry + (slot * 4)], securityKey());
-            case Pouch::PCItem:
-                return std::make_unique<Item3>(&data[OFS_PCItem + (slot * 4)]);
-            default:
-                return nullptr;
+            return std::make_unique<Item3>(slots + slot * 4, pouchKey(pouch));
+        }
+        return nullptr;
+    }
+    size_t Sav3::readPouch(Pouch pouch, std::span<ItemEntry> out) const
+    {
+        u16 key      = pouchKey(pouch);
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(out.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            out[slot] = Item3(slots + slot * 4, key).entry();
+        }
+        return count;
+    }
+    void Sav3::writePouch(Pouch pouch, std::span<const ItemEntry> items)
+    {
+        u16 key      = pouchKey(pouch);
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(items.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            Item3(items[slot], key).write(slots + slot * 4);
         }
     }
 
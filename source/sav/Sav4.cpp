@@ -122,32 +122,23 @@ namespace pksm
         }
     }
 
+    std::vector<Sav::BlockRange> Sav4::blockMap(void) const
+    {
+        const u32 generalEnd   = game == Game::DP ? 0xC0EC : game == Game::Pt ? 0xCF18 : 0xF618;
+        const u32 storageStart = game == Game::DP ? 0xC100 : game == Game::Pt ? 0xCF2C : 0xF700;
+        const u32 storageEnd   = game == Game::DP ? 0x1E2CC : game == Game::Pt ? 0x1F0FC : 0x21A00;
+        return {{u32(gbo), generalEnd}, {u32(sbo) + storageStart, storageEnd - storageStart}};
+    }
+
     void Sav4::resign(void)
     {
-        u16 cs;
-        // start, end, chkoffset
-        int general[3] = {0x0,
-            game == Game::DP   ? 0xC0EC
-            : game == Game::Pt ? 0xCF18
-                               : 0xF618,
-            game == Game::DP   ? 0xC0FE
-            : game == Game::Pt ? 0xCF2A
-                               : 0xF626};
-        int storage[3] = {game == Game::DP   ? 0xC100
-                          : game == Game::Pt ? 0xCF2C
-                                             : 0xF700,
-            game == Game::DP   ? 0x1E2CC
-            : game == Game::Pt ? 0x1F0FC
-                               : 0x21A00,
-            game == Game::DP   ? 0x1E2DE
-            : game == Game::Pt ? 0x1F10E
-                               : 0x21A0E};
-
-        cs = pksm::crypto::ccitt16({&data[gbo + general[0]], (size_t)(general[1] - general[0])});
-        LittleEndian::convertFrom<u16>(&data[gbo + general[2]], cs);
-
-        cs = pksm::crypto::ccitt16({&data[sbo + storage[0]], (size_t)(storage[1] - storage[0])});
-        LittleEndian::convertFrom<u16>(&data[sbo + storage[2]], cs);
+        // Each block's checksum sits in its footer
+        const u32 chkOffset = game == Game::HGSS ? 0xE : 0x12;
+        for (const BlockRange& block : blockMap())
+        {
+            u16 cs = pksm::crypto::ccitt16({&data[block.offset], block.length});
+            LittleEndian::convertFrom<u16>(&data[block.offset + block.length + chkOffset], cs);
+        }
     }
 
     u16 Sav4::TID(void) const
@@ -196,11 +187,11 @@ namespace pksm
 
     std::string Sav4::otName(void) const
     {
-        return StringUtils::transString45(StringUtils::getString4(data.get(), Trainer1, 8));
+        return StringUtils::getString4(data.get(), Trainer1, 8, StringUtils::CharSwap::Gen45);
     }
     void Sav4::otName(const std::string_view& v)
     {
-        StringUtils::setString4(data.get(), StringUtils::transString45(v), Trainer1, 8);
+        StringUtils::setString4(data.get(), v, Trainer1, 8, StringUtils::CharSwap::Gen45);
     }
 
     u32 Sav4::money(void) const
@@ -309,6 +300,11 @@ namespace pksm
         return PKX::getPKM<Generation::FOUR>(&data[boxOffset(box, slot)], PK4::BOX_LENGTH);
     }
 
+    std::span<const u8> Sav4::boxSlotData(u8 box, u8 slot) const
+    {
+        return {&data[boxOffset(box, slot)], PK4::BOX_LENGTH};
+    }
+
     void Sav4::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::FOUR)
@@ -382,13 +378,15 @@ namespace pksm
 
     std::string Sav4::boxName(u8 box) const
     {
-        return StringUtils::transString45(StringUtils::getString4(
-            data.get(), boxOffset(18, 0) + box * 0x28 + (game == Game::HGSS ? 0x8 : 0), 9));
+        return StringUtils::getString4(data.get(),
+            boxOffset(18, 0) + box * 0x28 + (game == Game::HGSS ? 0x8 : 0), 9,
+            StringUtils::CharSwap::Gen45);
     }
     void Sav4::boxName(u8 box, const std::string_view& name)
     {
-        StringUtils::setString4(data.get(), StringUtils::transString45(name),
-            boxOffset(18, 0) + box * 0x28 + (game == Game::HGSS ? 0x8 : 0), 9);
+        StringUtils::setString4(data.get(), name,
+            boxOffset(18, 0) + box * 0x28 + (game == Game::HGSS ? 0x8 : 0), 9,
+            StringUtils::CharSwap::Gen45);
     }
 
     int adjustWallpaper(int value, int shift)
@@ -843,63 +841,66 @@ namespace pksm
         return std::make_unique<PGT>(data.get() + WondercardData + pos * PGT::length);
     }
 
-    void Sav4::item(const Item& item, Pouch pouch, u16 slot)
+    u8* Sav4::pouchStart(Pouch pouch) const
     {
-        Item4 inject = static_cast<Item4>(item);
-        auto write   = inject.bytes();
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
-                break;
+                return &data[PouchHeldItem];
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
-                break;
+                return &data[PouchKeyItem];
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
-                break;
+                return &data[PouchTMHM];
             case Pouch::Mail:
-                std::copy(write.begin(), write.end(), &data[MailItems + slot * 4]);
-                break;
+                return &data[MailItems];
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
-                break;
+                return &data[PouchMedicine];
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
-                break;
+                return &data[PouchBerry];
             case Pouch::Ball:
-                std::copy(write.begin(), write.end(), &data[PouchBalls + slot * 4]);
-                break;
+                return &data[PouchBalls];
             case Pouch::Battle:
-                std::copy(write.begin(), write.end(), &data[BattleItems + slot * 4]);
-                break;
+                return &data[BattleItems];
             default:
-                return;
+                return nullptr;
+        }
+    }
+
+    void Sav4::item(const Item& item, Pouch pouch, u16 slot)
+    {
+        if (u8* slots = pouchStart(pouch))
+        {
+            static_cast<Item4>(item).write(slots + slot * 4);
         }
     }
 
     std::unique_ptr<Item> Sav4::item(Pouch pouch, u16 slot) const
     {
-        switch (pouch)
+        if (u8* slots = pouchStart(pouch))
         {
-            case Pouch::NormalItem:
-                return std::make_unique<Item4>(&data[PouchHeldItem + slot * 4]);
-            case Pouch::KeyItem:
-                return std::make_unique<Item4>(&data[PouchKeyItem + slot * 4]);
-            case Pouch::TM:
-                return std::make_unique<Item4>(&data[PouchTMHM + slot * 4]);
-            case Pouch::Mail:
-                return std::make_unique<Item4>(&data[MailItems + slot * 4]);
-            case Pouch::Medicine:
-                return std::make_unique<Item4>(&data[PouchMedicine + slot * 4]);
-            case Pouch::Berry:
-                return std::make_unique<Item4>(&data[PouchBerry + slot * 4]);
-            case Pouch::Ball:
-                return std::make_unique<Item4>(&data[PouchBalls + slot * 4]);
-            case Pouch::Battle:
-                return std::make_unique<Item4>(&data[BattleItems + slot * 4]);
-            default:
-                return nullptr;
+            return std::make_unique<Item4>(slots + slot * 4);
+        }
+        return nullptr;
+    }
+
+    size_t Sav4::readPouch(Pouch pouch, std::span<ItemEntry> out) const
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(out.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            out[slot] = Item4(slots + slot * 4).entry();
+        }
+        return count;
+    }
+
+    void Sav4::writePouch(Pouch pouch, std::span<const ItemEntry> items)
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(items.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            Item4(items[slot]).write(slots + slot * 4);
         }
     }
 
@@ -930,43 +931,4 @@ namespace pksm
                             : game == Game::Pt ? 13
                                                : 13}};
     }
-
-    std::map<Sav::Pouch, std::vector<int>> Sav4::validItems() const
-    {
-        return {
-            {Pouch::NormalItem,
-                {68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88,
-                    89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
-                    107, 108, 109, 110, 111, 112, 135, 136, 213, 214, 215, 216, 217, 218, 219, 220,
-                    221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236,
-                    237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252,
-                    253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
-                    269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
-                    285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
-                    301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
-                    317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327}},
-            {Pouch::KeyItem, {434, 435, 437, 444, 445, 446, 447, 450, 456, 464, 465, 466, 468, 469,
-                                 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482,
-                                 483, 484, 501, 502, 503, 504, 532, 533, 534, 535, 536}},
-            {Pouch::TM,
-                {328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343,
-                    344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359,
-                    360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375,
-                    376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391,
-                    392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407,
-                    408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423,
-                    424, 425, 426, 427}},
-            {Pouch::Mail, {137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148}},
-            {Pouch::Medicine,
-                {17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
-                    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54}},
-            {Pouch::Berry, {149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
-                               163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
-                               177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
-                               191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204,
-                               205, 206, 207, 208, 209, 210, 211, 212}},
-            {Pouch::Ball, {1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 492, 493, 494, 495,
-                              496, 497, 498, 499, 500}},
-            {Pouch::Battle, {55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67}}};
-    }
 }
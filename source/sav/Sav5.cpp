@@ -81,13 +81,13 @@ namespace pksm
 
     std::string Sav5::otName(void) const
     {
-        return StringUtils::transString45(
-            StringUtils::getString(data.get(), Trainer1 + 0x4, 8, u'\uFFFF'));
+        return StringUtils::getString(
+            data.get(), Trainer1 + 0x4, 8, u'\uFFFF', StringUtils::CharSwap::Gen45);
     }
     void Sav5::otName(const std::string_view& v)
     {
         StringUtils::setString(
-            data.get(), StringUtils::transString45(v), Trainer1 + 0x4, 8, u'\uFFFF', 0);
+            data.get(), v, Trainer1 + 0x4, 8, u'\uFFFF', 0, StringUtils::CharSwap::Gen45);
     }
 
     u32 Sav5::money(void) const
@@ -193,6 +193,11 @@ namespace pksm
         return PKX::getPKM<Generation::FIVE>(&data[boxOffset(box, slot)], PK5::BOX_LENGTH);
     }
 
+    std::span<const u8> Sav5::boxSlotData(u8 box, u8 slot) const
+    {
+        return {&data[boxOffset(box, slot)], PK5::BOX_LENGTH};
+    }
+
     void Sav5::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::FIVE)
@@ -411,13 +416,13 @@ namespace pksm
 
     std::string Sav5::boxName(u8 box) const
     {
-        return StringUtils::transString45(
-            StringUtils::getString(data.get(), PCLayout + 0x28 * box + 4, 9, u'\uFFFF'));
+        return StringUtils::getString(
+            data.get(), PCLayout + 0x28 * box + 4, 9, u'\uFFFF', StringUtils::CharSwap::Gen45);
     }
     void Sav5::boxName(u8 box, const std::string_view& name)
     {
-        StringUtils::setString(data.get(), StringUtils::transString45(name),
-            PCLayout + 0x28 * box + 4, 9, u'\uFFFF', 0);
+        StringUtils::setString(data.get(), name, PCLayout + 0x28 * box + 4, 9, u'\uFFFF', 0,
+            StringUtils::CharSwap::Gen45);
     }
 
     u8 Sav5::boxWallpaper(u8 box) const
@@ -479,48 +484,60 @@ namespace pksm
         return std::make_unique<PGF>(&data[WondercardData + pos * PGF::length]);
     }
 
-    void Sav5::item(const Item& item, Pouch pouch, u16 slot)
+    u8* Sav5::pouchStart(Pouch pouch) const
     {
-        Item5 inject = static_cast<Item5>(item);
-        auto write   = inject.bytes();
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
-                break;
+                return &data[PouchHeldItem];
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
-                break;
+                return &data[PouchKeyItem];
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
-                break;
+                return &data[PouchTMHM];
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
-                break;
+                return &data[PouchMedicine];
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
-                break;
+                return &data[PouchBerry];
             default:
-                return;
+                return nullptr;
+        }
+    }
+
+    void Sav5::item(const Item& item, Pouch pouch, u16 slot)
+    {
+        if (u8* slots = pouchStart(pouch))
+        {
+            static_cast<Item5>(item).write(slots + slot * 4);
         }
     }
 
     std::unique_ptr<Item> Sav5::item(Pouch pouch, u16 slot) const
     {
-        switch (pouch)
+        if (u8* slots = pouchStart(pouch))
         {
-            case Pouch::NormalItem:
-                return std::make_unique<Item5>(&data[PouchHeldItem + slot * 4]);
-            case Pouch::KeyItem:
-                return std::make_unique<Item5>(&data[PouchKeyItem + slot * 4]);
-            case Pouch::TM:
-                return std::make_unique<Item5>(&data[PouchTMHM + slot * 4]);
-            case Pouch::Medicine:
-                return std::make_unique<Item5>(&data[PouchMedicine + slot * 4]);
-            case Pouch::Berry:
-                return std::make_unique<Item5>(&data[PouchBerry + slot * 4]);
-            default:
-                return nullptr;
+            return std::make_unique<Item5>(slots + slot * 4);
+        }
+        return nullptr;
+    }
+
+    size_t Sav5::readPouch(Pouch pouch, std::span<ItemEntry> out) const
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(out.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            out[slot] = Item5(slots + slot * 4).entry();
+        }
+        return count;
+    }
+
+    void Sav5::writePouch(Pouch pouch, std::span<const ItemEntry> items)
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(items.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            Item5(items[slot]).write(slots + slot * 4);
         }
     }
 
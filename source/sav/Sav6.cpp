@@ -108,12 +108,13 @@ namespace pksm
 
     std::string Sav6::otName(void) const
     {
-        return StringUtils::transString67(
-            StringUtils::getString(data.get(), TrainerCard + 0x48, 13));
+        return StringUtils::getString(
+            data.get(), TrainerCard + 0x48, 13, u'\0', StringUtils::CharSwap::Gen67);
     }
     void Sav6::otName(const std::string_view& v)
     {
-        StringUtils::setString(data.get(), StringUtils::transString67(v), TrainerCard + 0x48, 13);
+        StringUtils::setString(
+            data.get(), v, TrainerCard + 0x48, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
     }
 
     u32 Sav6::money(void) const
@@ -220,6 +221,11 @@ namespace pksm
         return PKX::getPKM<Generation::SIX>(&data[boxOffset(box, slot)], PK6::BOX_LENGTH);
     }
 
+    std::span<const u8> Sav6::boxSlotData(u8 box, u8 slot) const
+    {
+        return {&data[boxOffset(box, slot)], PK6::BOX_LENGTH};
+    }
+
     void Sav6::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::SIX)
@@ -652,13 +658,13 @@ namespace pksm
 
     std::string Sav6::boxName(u8 box) const
     {
-        return StringUtils::transString67(
-            StringUtils::getString(data.get(), PCLayout + 0x22 * box, 17));
+        return StringUtils::getString(
+            data.get(), PCLayout + 0x22 * box, 17, u'\0', StringUtils::CharSwap::Gen67);
     }
     void Sav6::boxName(u8 box, const std::string_view& name)
     {
-        StringUtils::setString(
-            data.get(), StringUtils::transString67(name), PCLayout + 0x22 * box, 17);
+        StringUtils::setString(data.get(), name, PCLayout + 0x22 * box, 17, u'\0', u'\0',
+            StringUtils::CharSwap::Gen67);
     }
 
     u8 Sav6::boxWallpaper(u8 box) const
@@ -714,48 +720,60 @@ namespace pksm
         return std::make_unique<WC6>(&data[WondercardData + pos * WC6::length]);
     }
 
-    void Sav6::item(const Item& item, Pouch pouch, u16 slot)
+    u8* Sav6::pouchStart(Pouch pouch) const
     {
-        Item6 inject = static_cast<Item6>(item);
-        auto write   = inject.bytes();
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
-                break;
+                return &data[PouchHeldItem];
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
-                break;
+                return &data[PouchKeyItem];
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
-                break;
+                return &data[PouchTMHM];
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
-                break;
+                return &data[PouchMedicine];
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
-                break;
+                return &data[PouchBerry];
             default:
-                return;
+                return nullptr;
+        }
+    }
+
+    void Sav6::item(const Item& item, Pouch pouch, u16 slot)
+    {
+        if (u8* slots = pouchStart(pouch))
+        {
+            static_cast<Item6>(item).write(slots + slot * 4);
         }
     }
 
     std::unique_ptr<Item> Sav6::item(Pouch pouch, u16 slot) const
     {
-        switch (pouch)
+        if (u8* slots = pouchStart(pouch))
         {
-            case Pouch::NormalItem:
-                return std::make_unique<Item6>(&data[PouchHeldItem + slot * 4]);
-            case Pouch::KeyItem:
-                return std::make_unique<Item6>(&data[PouchKeyItem + slot * 4]);
-            case Pouch::TM:
-                return std::make_unique<Item6>(&data[PouchTMHM + slot * 4]);
-            case Pouch::Medicine:
-                return std::make_unique<Item6>(&data[PouchMedicine + slot * 4]);
-            case Pouch::Berry:
-                return std::make_unique<Item6>(&data[PouchBerry + slot * 4]);
-            default:
-                return nullptr;
+            return std::make_unique<Item6>(slots + slot * 4);
+        }
+        return nullptr;
+    }
+
+    size_t Sav6::readPouch(Pouch pouch, std::span<ItemEntry> out) const
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(out.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            out[slot] = Item6(slots + slot * 4).entry();
+        }
+        return count;
+    }
+
+    void Sav6::writePouch(Pouch pouch, std::span<const ItemEntry> items)
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(items.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            Item6(items[slot]).write(slots + slot * 4);
         }
     }
 
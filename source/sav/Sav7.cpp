@@ -107,13 +107,13 @@ namespace pksm
 
     std::string Sav7::otName(void) const
     {
-        return StringUtils::transString67(
-            StringUtils::getString(data.get(), TrainerCard + 0x38, 13));
+        return StringUtils::getString(
+            data.get(), TrainerCard + 0x38, 13, u'\0', StringUtils::CharSwap::Gen67);
     }
     void Sav7::otName(const std::string_view& v)
     {
         return StringUtils::setString(
-            data.get(), StringUtils::transString67(v), TrainerCard + 0x38, 13);
+            data.get(), v, TrainerCard + 0x38, 13, u'\0', u'\0', StringUtils::CharSwap::Gen67);
     }
 
     u32 Sav7::money(void) const
@@ -220,6 +220,11 @@ namespace pksm
         return PKX::getPKM<Generation::SEVEN>(&data[boxOffset(box, slot)], PK7::BOX_LENGTH);
     }
 
+    std::span<const u8> Sav7::boxSlotData(u8 box, u8 slot) const
+    {
+        return {&data[boxOffset(box, slot)], PK7::BOX_LENGTH};
+    }
+
     void Sav7::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::SEVEN)
@@ -535,13 +540,13 @@ namespace pksm
 
     std::string Sav7::boxName(u8 box) const
     {
-        return StringUtils::transString67(
-            StringUtils::getString(data.get(), PCLayout + 0x22 * box, 17));
+        return StringUtils::getString(
+            data.get(), PCLayout + 0x22 * box, 17, u'\0', StringUtils::CharSwap::Gen67);
     }
     void Sav7::boxName(u8 box, const std::string_view& name)
     {
-        StringUtils::setString(
-            data.get(), StringUtils::transString67(name), PCLayout + 0x22 * box, 17);
+        StringUtils::setString(data.get(), name, PCLayout + 0x22 * box, 17, u'\0', u'\0',
+            StringUtils::CharSwap::Gen67);
     }
 
     u8 Sav7::boxWallpaper(u8 box) const
@@ -597,58 +602,64 @@ namespace pksm
         return std::make_unique<WC7>(&data[WondercardData + pos * WC7::length]);
     }
 
-    void Sav7::item(const Item& item, Pouch pouch, u16 slot)
+    u8* Sav7::pouchStart(Pouch pouch) const
     {
-        Item7 inject = static_cast<Item7>(item);
-        auto write   = inject.bytes();
         switch (pouch)
         {
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
-                break;
+                return &data[PouchHeldItem];
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
-                break;
+                return &data[PouchKeyItem];
             case Pouch::TM:
-                std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
-                break;
+                return &data[PouchTMHM];
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
-                break;
+                return &data[PouchMedicine];
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
-                break;
+                return &data[PouchBerry];
             case Pouch::ZCrystals:
-                std::copy(write.begin(), write.end(), &data[PouchZCrystals + slot * 4]);
-                break;
+                return &data[PouchZCrystals];
             case Pouch::RotomPower:
-                std::copy(write.begin(), write.end(), &data[BattleItems + slot * 4]);
-                break;
+                return &data[BattleItems];
             default:
-                return;
+                return nullptr;
+        }
+    }
+
+    void Sav7::item(const Item& item, Pouch pouch, u16 slot)
+    {
+        if (u8* slots = pouchStart(pouch))
+        {
+            static_cast<Item7>(item).write(slots + slot * 4);
         }
     }
 
     std::unique_ptr<Item> Sav7::item(Pouch pouch, u16 slot) const
     {
-        switch (pouch)
+        if (u8* slots = pouchStart(pouch))
         {
-            case Pouch::NormalItem:
-                return std::make_unique<Item7>(&data[PouchHeldItem + slot * 4]);
-            case Pouch::KeyItem:
-                return std::make_unique<Item7>(&data[PouchKeyItem + slot * 4]);
-            case Pouch::TM:
-                return std::make_unique<Item7>(&data[PouchTMHM + slot * 4]);
-            case Pouch::Medicine:
-                return std::make_unique<Item7>(&data[PouchMedicine + slot * 4]);
-            case Pouch::Berry:
-                return std::make_unique<Item7>(&data[PouchBerry + slot * 4]);
-            case Pouch::ZCrystals:
-                return std::make_unique<Item7>(&data[PouchZCrystals + slot * 4]);
-            case Pouch::RotomPower:
-                return std::make_unique<Item7>(&data[BattleItems + slot * 4]);
-            default:
-                return nullptr;
+            return std::make_unique<Item7>(slots + slot * 4);
+        }
+        return nullptr;
+    }
+
+    size_t Sav7::readPouch(Pouch pouch, std::span<ItemEntry> out) const
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(out.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            out[slot] = Item7(slots + slot * 4).entry();
+        }
+        return count;
+    }
+
+    void Sav7::writePouch(Pouch pouch, std::span<const ItemEntry> items)
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(items.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            Item7(items[slot]).write(slots + slot * 4);
         }
     }
 
@@ -26,28 +26,145 @@
 
 #include "sav/Sav8.hpp"
 #include "pkx/PK8.hpp"
+#include "utils/endian.hpp"
 #include <algorithm>
 
 namespace pksm
 {
-    Sav8::Sav8(const std::shared_ptr<u8[]>& dt, size_t length) : Sav(dt, length)
+    Sav8::Sav8(const std::shared_ptr<u8[]>& dt, size_t length, bool inPlace)
+        : Sav(dt, length), overlay(inPlace ? dt : std::shared_ptr<u8[]>(new u8[length]))
     {
-        pksm::crypto::swsh::applyXor(dt, length);
-        blocks = pksm::crypto::swsh::getBlockList(dt, length);
+        if (!inPlace)
+        {
+            std::copy(dt.get(), dt.get() + length, overlay.get());
+        }
+        pksm::crypto::swsh::applyXor(overlay, length);
+        blocks = pksm::crypto::swsh::getBlockList({overlay.get(), length}, false);
     }
 
-    std::shared_ptr<pksm::crypto::swsh::SCBlock> Sav8::getBlock(u32 key) const
+    pksm::crypto::swsh::SCBlock* Sav8::getBlock(u32 key) const
     {
         // binary search
         auto found = std::lower_bound(blocks.begin(), blocks.end(), key,
-            [](const std::shared_ptr<pksm::crypto::swsh::SCBlock>& block, u32 key) {
-                return block->key() < key;
-            });
-        if ((*found)->key() != key)
+            [](const pksm::crypto::swsh::SCBlock& block, u32 key) { return block.key() < key; });
+        if (found == blocks.end() || found->key() != key)
         {
             return nullptr;
         }
-        return *found;
+        return &*found;
+    }
+
+    namespace
+    {
+        // Patch layout, all little endian:
+        //   u32 magic, u8[32] signature of the base save, u32 record count
+        //   per record: u32 key, u8 block type, u32 data size, data
+        constexpr u32 PATCH_MAGIC      = 0x50445753; // "SWDP"
+        constexpr size_t SIGNATURE_LEN = 32;
+        constexpr size_t HEADER_LEN    = 4 + SIGNATURE_LEN + 4;
+        constexpr size_t RECORD_LEN    = 4 + 1 + 4;
+
+        bool isBool(pksm::crypto::swsh::SCBlock::SCBlockType type)
+        {
+            return type == pksm::crypto::swsh::SCBlock::SCBlockType::Bool1 ||
+                   type == pksm::crypto::swsh::SCBlock::SCBlockType::Bool2;
+        }
+    }
+
+    std::vector<u8> Sav8::blockDiff(const Sav8& base) const
+    {
+        if (encrypted || base.encrypted || blocks.size() != base.blocks.size())
+        {
+            return {};
+        }
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            if (blocks[i].key() != base.blocks[i].key() ||
+                blocks[i].size() != base.blocks[i].size())
+            {
+                return {};
+            }
+        }
+
+        std::vector<u8> ret(HEADER_LEN);
+        LittleEndian::convertFrom<u32>(ret.data(), PATCH_MAGIC);
+        std::copy(base.overlay.get() + base.length - SIGNATURE_LEN,
+            base.overlay.get() + base.length, ret.data() + 4);
+
+        u32 count = 0;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            if (blocks[i].sameContents(base.blocks[i]))
+            {
+                continue;
+            }
+            const size_t ofs = ret.size();
+            ret.resize(ofs + RECORD_LEN + blocks[i].size());
+            LittleEndian::convertFrom<u32>(ret.data() + ofs, blocks[i].key());
+            ret[ofs + 4] = u8(blocks[i].blockType());
+            LittleEndian::convertFrom<u32>(ret.data() + ofs + 5, blocks[i].size());
+            const u8* src = blocks[i].decryptedData();
+            std::copy(src, src + blocks[i].size(), ret.data() + ofs + RECORD_LEN);
+            count++;
+        }
+        LittleEndian::convertFrom<u32>(ret.data() + 4 + SIGNATURE_LEN, count);
+
+        return ret;
+    }
+
+    bool Sav8::applyBlockPatch(std::span<const u8> patch)
+    {
+        using pksm::crypto::swsh::SCBlock;
+
+        if (encrypted || patch.size() < HEADER_LEN ||
+            LittleEndian::convertTo<u32>(patch.data()) != PATCH_MAGIC ||
+            !std::equal(patch.begin() + 4, patch.begin() + 4 + SIGNATURE_LEN,
+                overlay.get() + length - SIGNATURE_LEN))
+        {
+            return false;
+        }
+
+        // Validate every record before touching any block
+        const u32 count = LittleEndian::convertTo<u32>(patch.data() + 4 + SIGNATURE_LEN);
+        size_t ofs      = HEADER_LEN;
+        for (u32 i = 0; i < count; i++)
+        {
+            if (patch.size() - ofs < RECORD_LEN)
+            {
+                return false;
+            }
+            SCBlock* block  = getBlock(LittleEndian::convertTo<u32>(patch.data() + ofs));
+            const auto type = SCBlock::SCBlockType(patch[ofs + 4]);
+            const u32 size  = LittleEndian::convertTo<u32>(patch.data() + ofs + 5);
+            if (block == nullptr || block->size() != size ||
+                patch.size() - ofs - RECORD_LEN < size)
+            {
+                return false;
+            }
+            // Bool1 and Bool2 may be swapped for each other; any other type change is invalid
+            if (type != block->blockType() && (!isBool(type) || !isBool(block->blockType())))
+            {
+                return false;
+            }
+            ofs += RECORD_LEN + size;
+        }
+        if (ofs != patch.size())
+        {
+            return false;
+        }
+
+        ofs = HEADER_LEN;
+        for (u32 i = 0; i < count; i++)
+        {
+            SCBlock* block  = getBlock(LittleEndian::convertTo<u32>(patch.data() + ofs));
+            const u32 size  = LittleEndian::convertTo<u32>(patch.data() + ofs + 5);
+            const u8* start = patch.data() + ofs + RECORD_LEN;
+            block->blockType(SCBlock::SCBlockType(patch[ofs + 4]));
+            std::copy(start, start + size, block->decryptedData());
+            ofs += RECORD_LEN + size;
+        }
+
+        return true;
     }
 
     std::unique_ptr<PKX> Sav8::emptyPkm() const
@@ -94,11 +211,12 @@ namespace pksm
         {
             for (auto& block : blocks)
             {
-                block->encrypt();
+                block.encrypt();
             }
 
-            pksm::crypto::swsh::applyXor(data, length);
-            pksm::crypto::swsh::sign(data, length);
+            pksm::crypto::swsh::applyXor(overlay, length);
+            pksm::crypto::swsh::sign(overlay, length);
+            std::copy(overlay.get(), overlay.get() + length, data.get());
         }
         encrypted = true;
     }
@@ -107,7 +225,7 @@ namespace pksm
     {
         if (encrypted)
         {
-            pksm::crypto::swsh::applyXor(data, length);
+            pksm::crypto::swsh::applyXor(overlay, length);
         }
         encrypted = false;
 
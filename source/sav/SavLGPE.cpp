@@ -26,6 +26,7 @@
 
 #include "sav/SavLGPE.hpp"
 #include "pkx/PB7.hpp"
+#include "sav/ItemTable.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/i18n.hpp"
@@ -314,6 +315,11 @@ namespace pksm
         return PKX::getPKM<Generation::LGPE>(&data[boxOffset(box, slot)], PB7::PARTY_LENGTH);
     }
 
+    std::span<const u8> SavLGPE::boxSlotData(u8 box, u8 slot) const
+    {
+        return {&data[boxOffset(box, slot)], PB7::PARTY_LENGTH};
+    }
+
     void SavLGPE::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::LGPE)
@@ -833,17 +839,15 @@ namespace pksm
             }
             else if (wb7.item())
             {
-                auto valid  = validItems();
-                auto limits = pouches();
+                const ItemTable& valid = itemTable();
+                auto limits            = pouches();
                 for (int itemNum = 0; itemNum < wb7.items(); itemNum++)
                 {
                     bool currentSet = false;
                     for (size_t pouch = 0; pouch < limits.size(); pouch++)
                     {
                         // Check this is the correct pouch
-                        if (!currentSet &&
-                            std::binary_search(valid[limits[pouch].first].begin(),
-                                valid[limits[pouch].first].end(), wb7.object(itemNum)))
+                        if (!currentSet && valid.valid(limits[pouch].first, wb7.object(itemNum)))
                         {
                             for (int slot = 0; slot < limits[pouch].second; slot++)
                             {
@@ -873,81 +877,66 @@ namespace pksm
         }
     }
 
-    void SavLGPE::item(const Item& item, Pouch pouch, u16 slot)
+    u8* SavLGPE::pouchStart(Pouch pouch) const
     {
-        Item7b item7b = static_cast<Item7b>(item);
-        auto write    = item7b.bytes();
         switch (pouch)
         {
             case Pouch::Medicine:
-                if (slot < 60)
-                {
-                    std::copy(write.begin(), write.end(), &data[slot * 4]);
-                }
-                break;
+                return &data[0];
             case Pouch::TM:
-                if (slot < 108)
-                {
-                    std::copy(write.begin(), write.end(), &data[0xF0 + slot * 4]);
-                }
-                break;
+                return &data[0xF0];
             case Pouch::Candy:
-                if (slot < 200)
-                {
-                    std::copy(write.begin(), write.end(), &data[0x2A0 + slot * 4]);
-                }
-                break;
+                return &data[0x2A0];
             case Pouch::ZCrystals:
-                if (slot < 150)
-                {
-                    std::copy(write.begin(), write.end(), &data[0x5C0 + slot * 4]);
-                }
-                break;
+                return &data[0x5C0];
             case Pouch::CatchingItem:
-                if (slot < 50)
-                {
-                    std::copy(write.begin(), write.end(), &data[0x818 + slot * 4]);
-                }
-                break;
+                return &data[0x818];
             case Pouch::Battle:
-                if (slot < 150)
-                {
-                    std::copy(write.begin(), write.end(), &data[0x8E0 + slot * 4]);
-                }
-                break;
+                return &data[0x8E0];
             case Pouch::KeyItem:
             case Pouch::NormalItem:
-                if (slot < 150)
-                {
-                    std::copy(write.begin(), write.end(), &data[0xB38 + slot * 4]);
-                }
-                break;
+                return &data[0xB38];
             default:
-                break;
+                return nullptr;
+        }
+    }
+
+    void SavLGPE::item(const Item& item, Pouch pouch, u16 slot)
+    {
+        u8* slots = pouchStart(pouch);
+        if (slots && slot < pouchSize(pouch))
+        {
+            static_cast<Item7b>(item).write(slots + slot * 4);
         }
     }
 
     std::unique_ptr<Item> SavLGPE::item(Pouch pouch, u16 slot) const
     {
-        switch (pouch)
+        if (u8* slots = pouchStart(pouch))
         {
-            case Pouch::Medicine:
-                return std::make_unique<Item7b>(&data[slot * 4]);
-            case Pouch::TM:
-                return std::make_unique<Item7b>(&data[0xF0 + slot * 4]);
-            case Pouch::Candy:
-                return std::make_unique<Item7b>(&data[0x2A0 + slot * 4]);
-            case Pouch::ZCrystals:
-                return std::make_unique<Item7b>(&data[0x5C0 + slot * 4]);
-            case Pouch::CatchingItem:
-                return std::make_unique<Item7b>(&data[0x818 + slot * 4]);
-            case Pouch::Battle:
-                return std::make_unique<Item7b>(&data[0x8E0 + slot * 4]);
-            case Pouch::KeyItem:
-            case Pouch::NormalItem:
-                return std::make_unique<Item7b>(&data[0xB38 + slot * 4]);
-            default:
-                return nullptr;
+            return std::make_unique<Item7b>(slots + slot * 4);
+        }
+        return nullptr;
+    }
+
+    size_t SavLGPE::readPouch(Pouch pouch, std::span<ItemEntry> out) const
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(out.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            out[slot] = Item7b(slots + slot * 4).entry();
+        }
+        return count;
+    }
+
+    void SavLGPE::writePouch(Pouch pouch, std::span<const ItemEntry> items)
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(items.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            Item7b(items[slot]).write(slots + slot * 4);
         }
     }
 
@@ -963,30 +952,38 @@ namespace pksm
             {Pouch::NormalItem, 150}};
     }
 
-    std::map<Sav::Pouch, std::vector<int>> SavLGPE::validItems() const
-    {
-        return {{Pouch::Medicine, {17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
-                                      38, 39, 40, 41, 709, 903}},
-            {Pouch::TM,
-                {328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343,
-                    344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359,
-                    360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375,
-                    376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387}},
-            {Pouch::Candy,
-                {50, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975,
-                    976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991,
-                    992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005,
-                    1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
-                    1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031,
-                    1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
-                    1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057}},
-            {Pouch::ZCrystals, {51, 53, 81, 82, 83, 84, 85, 849}},
-            {Pouch::CatchingItem, {1, 2, 3, 4, 12, 164, 166, 168, 861, 862, 863, 864, 865, 866}},
-            {Pouch::Battle, {55, 56, 57, 58, 59, 60, 61, 62, 656, 659, 660, 661, 662, 663, 671, 672,
-                                675, 676, 678, 679, 760, 762, 770, 773}},
-            {Pouch::NormalItem, {76, 77, 78, 79, 86, 87, 88, 89, 90, 91, 92, 93, 101, 102, 103, 113,
-                                    115, 121, 122, 123, 124, 125, 126, 127, 128, 442, 571, 632, 651,
-                                    795, 796, 872, 873, 874, 875, 876, 877, 878, 885, 886, 887, 888,
-                                    889, 890, 891, 892, 893, 894, 895, 896, 900, 901, 902}}};
+    const ItemTable& SavLGPE::itemTable() const
+    {
+        static constexpr auto items = makeItemTable(
+            PouchItems{Pouch::Medicine,
+                std::to_array<u16>({17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+                    38, 39, 40, 41, 709, 903})},
+            PouchItems{Pouch::TM,
+                std::to_array<u16>({328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+                    341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+                    357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+                    373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387})},
+            PouchItems{Pouch::Candy,
+                std::to_array<u16>({50, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971,
+                    972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987,
+                    988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002,
+                    1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
+                    1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+                    1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+                    1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+                    1055, 1056, 1057})},
+            PouchItems{Pouch::ZCrystals, std::to_array<u16>({51, 53, 81, 82, 83, 84, 85, 849})},
+            PouchItems{Pouch::CatchingItem,
+                std::to_array<u16>({1, 2, 3, 4, 12, 164, 166, 168, 861, 862, 863, 864, 865, 866})},
+            PouchItems{Pouch::Battle,
+                std::to_array<u16>({55, 56, 57, 58, 59, 60, 61, 62, 656, 659, 660, 661, 662, 663,
+                    671, 672, 675, 676, 678, 679, 760, 762, 770, 773})},
+            PouchItems{Pouch::NormalItem,
+                std::to_array<u16>({76, 77, 78, 79, 86, 87, 88, 89, 90, 91, 92, 93, 101, 102, 103,
+                    113, 115, 121, 122, 123, 124, 125, 126, 127, 128, 442, 571, 632, 651, 795, 796,
+                    872, 873, 874, 875, 876, 877, 878, 885, 886, 887, 888, 889, 890, 891, 892, 893,
+                    894, 895, 896, 900, 901, 902})});
+        static constexpr ItemTable table = items.view();
+        return table;
     }
 }
@@ -26,6 +26,7 @@
 
 #include "sav/SavSWSH.hpp"
 #include "pkx/PK8.hpp"
+#include "sav/ItemTable.hpp"
 #include "utils/endian.hpp"
 #include "utils/i18n.hpp"
 #include "utils/random.hpp"
@@ -181,7 +182,8 @@ constexpr void LittleEndian::convertFrom<DexEntry>(u8* data, const DexEntry& ent
 
 namespace pksm
 {
-    SavSWSH::SavSWSH(const std::shared_ptr<u8[]>& dt, size_t length) : Sav8(dt, length)
+    SavSWSH::SavSWSH(const std::shared_ptr<u8[]>& dt, size_t length, bool inPlace)
+        : Sav8(dt, length, inPlace)
     {
         game = Game::SWSH;
 
@@ -318,77 +320,65 @@ namespace pksm
         getBlock(PlayTime)->decryptedData()[3] = v;
     }
 
-    void SavSWSH::item(const Item& item, Pouch pouch, u16 slot)
+    u8* SavSWSH::pouchStart(Pouch pouch) const
     {
-        Item8 item8 = static_cast<Item8>(item);
-        auto write  = item.bytes();
+        u8* items = getBlock(Items)->decryptedData();
         switch (pouch)
         {
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), getBlock(Items)->decryptedData() + 4 * slot);
-                break;
+                return items;
             case Pouch::Ball:
-                std::copy(
-                    write.begin(), write.end(), getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
-                break;
+                return items + 0xF0;
             case Pouch::Battle:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
-                break;
+                return items + 0x168;
             case Pouch::Berry:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
-                break;
+                return items + 0x1B8;
             case Pouch::NormalItem:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
-                break;
+                return items + 0x2F8;
             case Pouch::TM:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
-                break;
+                return items + 0xB90;
             case Pouch::Treasure:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
-                break;
+                return items + 0xED8;
             case Pouch::Ingredient:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
-                break;
+                return items + 0x1068;
             case Pouch::KeyItem:
-                std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
-                break;
+                return items + 0x11F8;
             default:
-                break;
+                return nullptr;
+        }
+    }
+    void SavSWSH::item(const Item& item, Pouch pouch, u16 slot)
+    {
+        if (u8* slots = pouchStart(pouch))
+        {
+            static_cast<Item8>(item).write(slots + slot * 4);
         }
     }
     std::unique_ptr<Item> SavSWSH::item(Pouch pouch, u16 slot) const
     {
-        switch (pouch)
+        if (u8* slots = pouchStart(pouch))
         {
-            case Pouch::Medicine:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 4 * slot);
-            case Pouch::Ball:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
-            case Pouch::Battle:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
-            case Pouch::Berry:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
-            case Pouch::NormalItem:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
-            case Pouch::TM:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
-            case Pouch::Treasure:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
-            case Pouch::Ingredient:
-                return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
-            case Pouch::KeyItem:
-                return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
-            default:
-                return std::make_unique<Item8>();
+            return std::make_unique<Item8>(slots + slot * 4);
+        }
+        return std::make_unique<Item8>();
+    }
+    size_t SavSWSH::readPouch(Pouch pouch, std::span<ItemEntry> out) const
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(out.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            out[slot] = Item8(slots + slot * 4).entry();
+        }
+        return count;
+    }
+    void SavSWSH::writePouch(Pouch pouch, std::span<const ItemEntry> items)
+    {
+        u8* slots    = pouchStart(pouch);
+        size_t count = slots ? std::min(items.size(), size_t(pouchSize(pouch))) : 0;
+        for (size_t slot = 0; slot < count; slot++)
+        {
+            Item8(items[slot]).write(slots + slot * 4);
         }
     }
     std::vector<std::pair<Sav::Pouch, int>> SavSWSH::pouches(void) const
@@ -397,95 +387,106 @@ namespace pksm
             {Pouch::NormalItem, 550}, {Pouch::TM, 210}, {Pouch::Treasure, 100},
             {Pouch::Ingredient, 100}, {Pouch::KeyItem, 64}};
     }
-    std::map<Sav::Pouch, std::vector<int>> SavSWSH::validItems(void) const
-    {
-        return {{Pouch::Medicine,
-                    {17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
-                        37, 38, 39, 40, 41, 42, 43, 54, 134, 54, 591, 708, 709, 852, 903}},
-            {Pouch::Ball, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 492, 493, 494,
-                              495, 496, 497, 498, 499, 500, 576, 851}},
-            {Pouch::Battle, {55, 56, 57, 58, 59, 60, 61, 62, 63, 1580}},
-            {Pouch::Berry, {149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
-                               163, 169, 170, 171, 172, 173, 174, 184, 185, 186, 187, 188, 189, 190,
-                               191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204,
-                               205, 206, 207, 208, 209, 210, 211, 212, 686, 687, 688}},
-            {Pouch::NormalItem,
-                {45, 46, 47, 48, 49, 50, 51, 52, 53, 76, 77, 79, 80, 81, 82, 83, 84, 85, 107, 108,
-                    109, 110, 112, 116, 117, 118, 119, 135, 136, 213, 214, 215, 217, 218, 219, 220,
-                    221, 222, 223, 224, 225, 228, 234, 236, 237, 238, 239, 240, 241, 242, 243, 244,
-                    245, 246, 247, 248, 249, 250, 251, 253, 254, 255, 257, 229, 230, 231, 232, 233,
-                    234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
-                    259, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
-                    280, 281, 282, 283, 284, 250, 251, 252, 253, 254, 255, 257, 258, 259, 265, 266,
-                    267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 285, 286, 287, 288, 289, 290,
-                    291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 277,
-                    278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293,
-                    294, 295, 296, 297, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
-                    318, 319, 320, 321, 325, 326, 537, 538, 539, 298, 299, 300, 301, 302, 303, 304,
-                    305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 540, 541,
-                    542, 543, 544, 545, 546, 547, 564, 565, 566, 567, 568, 569, 570, 639, 640, 644,
-                    645, 646, 647, 319, 320, 321, 322, 323, 324, 325, 326, 485, 486, 487, 488, 489,
-                    490, 491, 537, 538, 539, 540, 541, 542, 648, 649, 650, 846, 849, 879, 880, 881,
-                    882, 883, 884, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 543, 544, 545,
-                    546, 547, 564, 565, 566, 567, 568, 569, 570, 639, 640, 644, 645, 646, 647, 648,
-                    649, 650, 914, 915, 916, 917, 918, 919, 920, 1103, 1104, 1109, 1110, 1111, 1112,
-                    1113, 1114, 1115, 1116, 1117, 1118, 846, 849, 879, 880, 881, 882, 883, 884, 904,
-                    905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 1119, 1120, 1121,
-                    1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1231, 1232, 1233, 1234, 1235,
-                    1236, 1237, 917, 918, 919, 920, 1103, 1104, 1109, 1110, 1111, 1112, 1113, 1114,
-                    1115, 1116, 1117, 1118, 1119, 1120, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
-                    1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1121, 1122, 1123,
-                    1124, 1125, 1126, 1127, 1128, 1129, 1231, 1232, 1233, 1234, 1235, 1236, 1237,
-                    1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250,
-                    1251, 1252, 1253, 1254, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
-                    1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
-                    1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313,
-                    1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
-                    1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
-                    1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352,
-                    1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365,
-                    1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378,
-                    1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
-                    1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404,
-                    1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417,
-                    1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
-                    1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443,
-                    1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
-                    1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
-                    1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482,
-                    1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495,
-                    1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508,
-                    1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521,
-                    1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
-                    1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547,
-                    1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560,
-                    1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
-                    1574, 1575, 1576, 1577, 1578, 1581, 1582, 1588}},
-            {Pouch::TM,
-                {328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343,
-                    344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359,
-                    360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375,
-                    376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391,
-                    392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407,
-                    408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 618, 619, 620, 690,
-                    691, 692, 693, 1230, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139,
-                    1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
-                    1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
-                    1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178,
-                    1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191,
-                    1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
-                    1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217,
-                    1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1579}},
-            {Pouch::Treasure, {86, 87, 88, 89, 90, 91, 92, 94, 106, 571, 580, 581, 582, 583, 795,
-                                  796, 1105, 1106, 1107, 1108}},
-            {Pouch::Ingredient,
-                {1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
-                    1098, 1099, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264}},
-            {Pouch::KeyItem,
-                {78, 628, 629, 631, 632, 628, 629, 631, 632, 638, 703, 703, 847, 943, 944, 945, 946,
-                    943, 944, 945, 946, 1074, 1075, 1076, 1077, 1080, 1081, 1100, 1074, 1075, 1076,
-                    1077, 1080, 1081, 1100, 1255, 1266, 1267, 1255, 1266, 1267, 1269, 1270, 1271,
-                    1278, 1269, 1270, 1271, 1278, 1583, 1584, 1585, 1586, 1587, 1589}}};
+    const ItemTable& SavSWSH::itemTable() const
+    {
+        static constexpr auto items = makeItemTable(
+            PouchItems{Pouch::Medicine,
+                std::to_array<u16>({17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+                    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 54, 134, 54, 591, 708, 709, 852,
+                    903})},
+            PouchItems{Pouch::Ball,
+                std::to_array<u16>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 492, 493,
+                    494, 495, 496, 497, 498, 499, 500, 576, 851})},
+            PouchItems{Pouch::Battle,
+                std::to_array<u16>({55, 56, 57, 58, 59, 60, 61, 62, 63, 1580})},
+            PouchItems{Pouch::Berry,
+                std::to_array<u16>({149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+                    162, 163, 169, 170, 171, 172, 173, 174, 184, 185, 186, 187, 188, 189, 190, 191,
+                    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+                    208, 209, 210, 211, 212, 686, 687, 688})},
+            PouchItems{Pouch::NormalItem,
+                std::to_array<u16>({45, 46, 47, 48, 49, 50, 51, 52, 53, 76, 77, 79, 80, 81, 82, 83,
+                    84, 85, 107, 108, 109, 110, 112, 116, 117, 118, 119, 135, 136, 213, 214, 215,
+                    217, 218, 219, 220, 221, 222, 223, 224, 225, 228, 234, 236, 237, 238, 239, 240,
+                    241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 253, 254, 255, 257, 229,
+                    230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245,
+                    246, 247, 248, 249, 259, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+                    276, 277, 278, 279, 280, 281, 282, 283, 284, 250, 251, 252, 253, 254, 255, 257,
+                    258, 259, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 285, 286,
+                    287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+                    303, 304, 305, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+                    290, 291, 292, 293, 294, 295, 296, 297, 306, 307, 308, 309, 310, 311, 312, 313,
+                    314, 315, 316, 317, 318, 319, 320, 321, 325, 326, 537, 538, 539, 298, 299, 300,
+                    301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+                    317, 318, 540, 541, 542, 543, 544, 545, 546, 547, 564, 565, 566, 567, 568, 569,
+                    570, 639, 640, 644, 645, 646, 647, 319, 320, 321, 322, 323, 324, 325, 326, 485,
+                    486, 487, 488, 489, 490, 491, 537, 538, 539, 540, 541, 542, 648, 649, 650, 846,
+                    849, 879, 880, 881, 882, 883, 884, 904, 905, 906, 907, 908, 909, 910, 911, 912,
+                    913, 543, 544, 545, 546, 547, 564, 565, 566, 567, 568, 569, 570, 639, 640, 644,
+                    645, 646, 647, 648, 649, 650, 914, 915, 916, 917, 918, 919, 920, 1103, 1104,
+                    1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 846, 849, 879, 880,
+                    881, 882, 883, 884, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915,
+                    916, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1231,
+                    1232, 1233, 1234, 1235, 1236, 1237, 917, 918, 919, 920, 1103, 1104, 1109, 1110,
+                    1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1238, 1239, 1240,
+                    1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
+                    1254, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1231, 1232, 1233,
+                    1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
+                    1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1279, 1280, 1281, 1282, 1283,
+                    1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296,
+                    1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+                    1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322,
+                    1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335,
+                    1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
+                    1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,
+                    1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374,
+                    1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
+                    1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
+                    1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413,
+                    1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
+                    1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+                    1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452,
+                    1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465,
+                    1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478,
+                    1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491,
+                    1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+                    1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+                    1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530,
+                    1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543,
+                    1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556,
+                    1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569,
+                    1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1581, 1582, 1588})},
+            PouchItems{Pouch::TM,
+                std::to_array<u16>({328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+                    341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+                    357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+                    373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388,
+                    389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+                    405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 618,
+                    619, 620, 690, 691, 692, 693, 1230, 1130, 1131, 1132, 1133, 1134, 1135, 1136,
+                    1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+                    1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162,
+                    1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
+                    1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,
+                    1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
+                    1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
+                    1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227,
+                    1228, 1229, 1579})},
+            PouchItems{Pouch::Treasure,
+                std::to_array<u16>({86, 87, 88, 89, 90, 91, 92, 94, 106, 571, 580, 581, 582, 583,
+                    795, 796, 1105, 1106, 1107, 1108})},
+            PouchItems{Pouch::Ingredient,
+                std::to_array<u16>({1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+                    1094, 1095, 1096, 1097, 1098, 1099, 1256, 1257, 1258, 1259, 1260, 1261, 1262,
+                    1263, 1264})},
+            PouchItems{Pouch::KeyItem,
+                std::to_array<u16>({78, 628, 629, 631, 632, 628, 629, 631, 632, 638, 703, 703, 847,
+                    943, 944, 945, 946, 943, 944, 945, 946, 1074, 1075, 1076, 1077, 1080, 1081,
+                    1100, 1074, 1075, 1076, 1077, 1080, 1081, 1100, 1255, 1266, 1267, 1255, 1266,
+                    1267, 1269, 1270, 1271, 1278, 1269, 1270, 1271, 1278, 1583, 1584, 1585, 1586,
+                    1587, 1589})});
+        static constexpr ItemTable table = items.view();
+        return table;
     }
 
     u8 SavSWSH::currentBox() const
@@ -546,6 +547,11 @@ namespace pksm
             getBlock(Box)->decryptedData() + offset, PK8::PARTY_LENGTH);
     }
 
+    std::span<const u8> SavSWSH::boxSlotData(u8 box, u8 slot) const
+    {
+        return {getBlock(Box)->decryptedData() + boxOffset(box, slot), PK8::PARTY_LENGTH};
+    }
+
     void SavSWSH::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::EIGHT)
@@ -819,17 +825,15 @@ namespace pksm
             }
             else if (wc8.item())
             {
-                auto valid  = validItems();
-                auto limits = pouches();
+                const ItemTable& valid = itemTable();
+                auto limits            = pouches();
                 for (int itemNum = 0; itemNum < wc8.items(); itemNum++)
                 {
                     bool currentSet = false;
                     for (size_t pouch = 0; pouch < limits.size(); pouch++)
                     {
                         // Check this is the correct pouch
-                        if (!currentSet &&
-                            std::binary_search(valid[limits[pouch].first].begin(),
-                                valid[limits[pouch].first].end(), wc8.object(itemNum)))
+                        if (!currentSet && valid.valid(limits[pouch].first, wc8.object(itemNum)))
                         {
                             for (int slot = 0; slot < limits[pouch].second; slot++)
                             {
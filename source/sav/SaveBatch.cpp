@@ -0,0 +1,138 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+
+#include "sav/SaveBatch.hpp"
+#include "sav/Sav.hpp"
+#include "utils/io.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+namespace pksm
+{
+    void SaveBatch::add(std::string path)
+    {
+        inputs.emplace_back(Input{std::move(path), nullptr, 0});
+    }
+
+    void SaveBatch::add(std::shared_ptr<u8[]> data, size_t length)
+    {
+        inputs.emplace_back(Input{"", std::move(data), length});
+    }
+
+    std::vector<SaveBatch::Status> SaveBatch::forEach(
+        const std::function<void(size_t index, const Sav& save)>& query, unsigned threads) const
+    {
+        std::vector<Status> ret(inputs.size());
+
+        std::atomic<size_t> next = 0;
+
+        auto work = [&] {
+            // Reused for every in-memory image this thread opens once no save holds it anymore
+            std::shared_ptr<u8[]> arena;
+            size_t arenaSize = 0;
+            for (size_t index = next++; index < inputs.size(); index = next++)
+            {
+                const Input& input = inputs[index];
+                std::shared_ptr<u8[]> data;
+                size_t length = 0;
+                if (!input.path.empty())
+                {
+                    std::tie(data, length) = io::mapFile(input.path);
+                }
+                else if (input.data && input.length > 0)
+                {
+                    if (arenaSize < input.length || arena.use_count() > 1)
+                    {
+                        arena     = std::shared_ptr<u8[]>(new u8[input.length]);
+                        arenaSize = input.length;
+                    }
+                    std::copy_n(input.data.get(), input.length, arena.get());
+                    data   = arena;
+                    length = input.length;
+                }
+                if (!data)
+                {
+                    ret[index].error = Error::Unreadable;
+                    continue;
+                }
+
+                std::unique_ptr<const Sav> save;
+                try
+                {
+                    std::vector<SaveCandidate> candidates = detectSaveFormat({data.get(), length});
+                    if (!candidates.empty())
+                    {
+                        // data is this thread's own copy or private mapping, so the save may
+                        // decode it in place
+                        ret[index].format = candidates.front().format;
+                        save = Sav::getSave(data, length, candidates.front(), Sav::ReadOnly, true);
+                    }
+                }
+                catch (const std::exception&)
+                {
+                    // Only Generation 8 block parsing throws; an uncaught exception here would
+                    // terminate the whole batch
+                    ret[index].error = Error::Corrupt;
+                    continue;
+                }
+                if (!save)
+                {
+                    ret[index].error = Error::Unrecognized;
+                    continue;
+                }
+
+                query(index, *save);
+            }
+        };
+
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        (void)threads;
+        work();
+#else
+        if (threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        threads = std::min<size_t>(threads, std::max<size_t>(inputs.size(), 1));
+
+        std::vector<std::thread> workers;
+        for (unsigned i = 1; i < threads; i++)
+        {
+            workers.emplace_back(work);
+        }
+        work();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+#endif
+
+        return ret;
+    }
+}
@@ -0,0 +1,324 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "sav/SaveDetection.hpp"
+#include "sav/SavSWSH.hpp"
+#include "utils/crypto.hpp"
+#include "utils/endian.hpp"
+#include <algorithm>
+#include <array>
+
+namespace pksm
+{
+    namespace
+    {
+        constexpr u8 CONFIDENCE_SIZE_ONLY = 50;
+        constexpr u8 CONFIDENCE_MAGIC     = 80;
+        constexpr u8 CONFIDENCE_CHECKSUM  = 100;
+
+        // Gen 3 sector layout
+        constexpr size_t G3_BLOCK_COUNT = 14;
+        constexpr size_t G3_SIZE_BLOCK  = 0x1000;
+        constexpr u32 G3_SIGNATURE      = 0x08012025;
+        constexpr u16 G3_SMALL_LENGTH   = 0xF2C;
+
+        // Gen 6+ block info tables begin with 'BEEF'
+        constexpr u32 BEEF = 0x42454546;
+
+        SaveCandidate candidate(SaveFormat format, u8 confidence,
+            GameVersion version = GameVersion::INVALID, Language language = Language::None)
+        {
+            return {format, confidence, version, language};
+        }
+
+        bool validSequence(std::span<const u8> data, size_t offset)
+        {
+            static constexpr u32 DATE_INTERNATIONAL = 0x20060623;
+            static constexpr u32 DATE_KOREAN        = 0x20070903;
+
+            if (LittleEndian::convertTo<u32>(&data[offset - 0xC]) != (offset & 0xFFFF))
+            {
+                return false;
+            }
+
+            u32 date = LittleEndian::convertTo<u32>(&data[offset - 0x8]);
+            return date == DATE_INTERNATIONAL || date == DATE_KOREAN;
+        }
+
+        bool validList(std::span<const u8> data, size_t ofs)
+        {
+            return (data[ofs] <= 30) && (data[ofs + 1 + data[ofs]] == 0xFF);
+        }
+
+        void detectGB(std::span<const u8> data, std::vector<SaveCandidate>& out)
+        {
+            if (validList(data, 0x288A) && validList(data, 0x2D6C))
+            {
+                // as well as all other languages not enumerated
+                out.emplace_back(
+                    candidate(SaveFormat::GSC, CONFIDENCE_MAGIC, GameVersion::GD, Language::ENG));
+            }
+            else if (validList(data, 0x2865) && validList(data, 0x2D10))
+            {
+                out.emplace_back(
+                    candidate(SaveFormat::GSC, CONFIDENCE_MAGIC, GameVersion::C, Language::ENG));
+            }
+            else if (validList(data, 0x2D10))
+            {
+                if (validList(data, 0x283E))
+                {
+                    out.emplace_back(candidate(
+                        SaveFormat::GSC, CONFIDENCE_MAGIC, GameVersion::GD, Language::JPN));
+                }
+                else if (validList(data, 0x281A))
+                {
+                    out.emplace_back(
+                        candidate(SaveFormat::GSC, CONFIDENCE_MAGIC, GameVersion::C, Language::JPN));
+                }
+            }
+            // there is no KOR crystal
+            else if (validList(data, 0x28CC) && validList(data, 0x2DAE))
+            {
+                out.emplace_back(
+                    candidate(SaveFormat::GSC, CONFIDENCE_MAGIC, GameVersion::GD, Language::KOR));
+            }
+
+            // Gen 1 has nothing to identify it by beyond the Japanese box lists, so it is always
+            // offered as a fallback behind any Gen 2 match
+            if (validList(data, 0x2ED5) && validList(data, 0x302D))
+            {
+                out.emplace_back(candidate(SaveFormat::RGBY, CONFIDENCE_MAGIC - 10,
+                    GameVersion::INVALID, Language::JPN));
+            }
+            else
+            {
+                out.emplace_back(candidate(SaveFormat::RGBY, CONFIDENCE_SIZE_ONLY - 25));
+            }
+        }
+
+        void detectGBA(std::span<const u8> data, std::vector<SaveCandidate>& out)
+        {
+            std::array<size_t, 2> zeroBlock;
+            std::array<bool, 2> complete;
+            for (size_t half = 0; half < 2; half++)
+            {
+                size_t base     = half * G3_BLOCK_COUNT * G3_SIZE_BLOCK;
+                u16 seen        = 0;
+                bool signatures = true;
+                zeroBlock[half] = G3_BLOCK_COUNT;
+                for (size_t i = 0; i < G3_BLOCK_COUNT; i++)
+                {
+                    size_t footer = base + i * G3_SIZE_BLOCK;
+                    s16 id        = LittleEndian::convertTo<s16>(&data[footer + 0xFF4]);
+                    if (id == 0 && zeroBlock[half] == G3_BLOCK_COUNT)
+                    {
+                        zeroBlock[half] = i;
+                    }
+                    if (id >= 0 && size_t(id) < G3_BLOCK_COUNT)
+                    {
+                        seen |= 1 << id;
+                    }
+                    signatures &=
+                        LittleEndian::convertTo<u32>(&data[footer + 0xFF8]) == G3_SIGNATURE;
+                }
+                complete[half] = signatures && seen == (1 << G3_BLOCK_COUNT) - 1;
+            }
+
+            size_t active;
+            if (zeroBlock[1] == G3_BLOCK_COUNT)
+            {
+                active = 0;
+            }
+            else if (zeroBlock[0] == G3_BLOCK_COUNT)
+            {
+                active = 1;
+            }
+            else
+            {
+                u32 count1 =
+                    LittleEndian::convertTo<u32>(&data[zeroBlock[0] * G3_SIZE_BLOCK + 0xFFC]);
+                u32 count2 = LittleEndian::convertTo<u32>(
+                    &data[(G3_BLOCK_COUNT + zeroBlock[1]) * G3_SIZE_BLOCK + 0xFFC]);
+                active = count1 > count2 ? 0 : 1;
+            }
+
+            size_t blockOfs0 = (active * G3_BLOCK_COUNT + zeroBlock[active]) * G3_SIZE_BLOCK;
+
+            u8 confidence = CONFIDENCE_SIZE_ONLY;
+            if (complete[active])
+            {
+                confidence = CONFIDENCE_MAGIC;
+                u32 sum    = pksm::crypto::sum32({&data[blockOfs0], G3_SMALL_LENGTH});
+                if (u16(sum + (sum >> 16)) == LittleEndian::convertTo<u16>(&data[blockOfs0 + 0xFF6]))
+                {
+                    confidence = CONFIDENCE_CHECKSUM;
+                }
+            }
+
+            u32 gameCode = LittleEndian::convertTo<u32>(&data[blockOfs0 + 0xAC]);
+            switch (gameCode)
+            {
+                case 1:
+                    out.emplace_back(candidate(SaveFormat::FRLG, confidence)); // fixed value
+                    break;
+                case 0:
+                    // no battle tower record data
+                    out.emplace_back(candidate(SaveFormat::RS, confidence));
+                    break;
+                default:
+                    // Ruby doesn't set data as far down as Emerald.
+                    // 00 FF 00 00 00 00 00 00 00 FF 00 00 00 00 00 00
+                    // ^ byte pattern in Emerald saves, is all zero in Ruby/Sapphire as far as I can
+                    // tell. Some saves have had data @ 0x550
+                    if (LittleEndian::convertTo<u64>(&data[blockOfs0 + 0xEE0]) != 0 ||
+                        LittleEndian::convertTo<u64>(&data[blockOfs0 + 0xEE8]) != 0)
+                    {
+                        out.emplace_back(candidate(SaveFormat::E, confidence));
+                    }
+                    else
+                    {
+                        out.emplace_back(candidate(SaveFormat::RS, confidence));
+                        out.emplace_back(candidate(SaveFormat::E, confidence / 2));
+                    }
+                    break;
+            }
+        }
+
+        void detectDS(std::span<const u8> data, std::vector<SaveCandidate>& out)
+        {
+            // Check for block identifiers
+            static constexpr std::array<std::pair<size_t, SaveFormat>, 3> footers = {
+                std::pair{size_t(0xC100), SaveFormat::DP}, std::pair{size_t(0xCF2C), SaveFormat::Pt},
+                std::pair{size_t(0xF628), SaveFormat::HGSS}};
+            for (const auto& [offset, format] : footers)
+            {
+                if (validSequence(data, offset))
+                {
+                    out.emplace_back(candidate(format, CONFIDENCE_CHECKSUM - 5));
+                }
+            }
+
+            // Check the other save
+            for (const auto& [offset, format] : footers)
+            {
+                if (validSequence(data, offset + 0x40000))
+                {
+                    out.emplace_back(candidate(format, CONFIDENCE_CHECKSUM - 10));
+                }
+            }
+
+            // Check for BW/B2W2 checksums
+            if (LittleEndian::convertTo<u16>(&data[0x24000 - 0x100 + 0x8C + 0xE]) ==
+                pksm::crypto::ccitt16({&data[0x24000 - 0x100], 0x8C}))
+            {
+                out.emplace_back(candidate(SaveFormat::BW, CONFIDENCE_CHECKSUM - 15));
+            }
+            if (LittleEndian::convertTo<u16>(&data[0x26000 - 0x100 + 0x94 + 0xE]) ==
+                pksm::crypto::ccitt16({&data[0x26000 - 0x100], 0x94}))
+            {
+                out.emplace_back(candidate(SaveFormat::B2W2, CONFIDENCE_CHECKSUM - 15));
+            }
+        }
+
+        // The block info table sits 0x1F0 bytes from the end of the 3DS/LGPE images; its first
+        // entry's checksum covers a small block at the very start of the save
+        template <u16 (*Checksum)(std::span<const u8>)>
+        void detectBlockInfo(std::span<const u8> data, size_t infoOfs, size_t firstLength,
+            SaveFormat format, std::vector<SaveCandidate>& out)
+        {
+            u8 confidence = CONFIDENCE_SIZE_ONLY;
+            if (LittleEndian::convertTo<u32>(&data[infoOfs]) == BEEF)
+            {
+                confidence = CONFIDENCE_MAGIC;
+                if (LittleEndian::convertTo<u16>(&data[infoOfs + 0xA]) ==
+                    Checksum({&data[0], firstLength}))
+                {
+                    confidence = CONFIDENCE_CHECKSUM;
+                }
+            }
+            out.emplace_back(candidate(format, confidence));
+        }
+    }
+
+    std::vector<SaveCandidate> detectSaveFormat(std::span<const u8> data)
+    {
+        std::vector<SaveCandidate> ret;
+        switch (data.size())
+        {
+            case 0x6CC00:
+                detectBlockInfo<pksm::crypto::crc16>(data, 0x6CA10, 0xE28, SaveFormat::USUM, ret);
+                break;
+            case 0x6BE00:
+                detectBlockInfo<pksm::crypto::crc16>(data, 0x6BC10, 0xDE0, SaveFormat::SM, ret);
+                break;
+            case 0x76000:
+                detectBlockInfo<pksm::crypto::ccitt16>(data, 0x75E10, 0x2C8, SaveFormat::ORAS, ret);
+                break;
+            case 0x65600:
+                detectBlockInfo<pksm::crypto::ccitt16>(data, 0x65410, 0x2C8, SaveFormat::XY, ret);
+                break;
+            case 0x80000:
+                detectDS(data, ret);
+                break;
+            case 0x20000:
+                detectGBA(data, ret);
+                break;
+            case 0x8000:
+            case 0x10000:
+            // Gen II VC saves
+            case 0x8010:
+            case 0x10010:
+            // Emulator standard saves
+            case 0x8030:
+            case 0x10030:
+                detectGB(data, ret);
+                break;
+            case 0xB8800:
+            case 0x100000:
+                detectBlockInfo<pksm::crypto::crc16_noinvert>(
+                    data, 0xB8610, 0xD90, SaveFormat::LGPE, ret);
+                break;
+            // SWSH saves are xored in their entirety; there is nothing cheap to probe
+            case SavSWSH::SIZE_G8SWSH:
+            case SavSWSH::SIZE_G8SWSH_1:
+            case SavSWSH::SIZE_G8SWSH_2:
+            case SavSWSH::SIZE_G8SWSH_2B:
+            case SavSWSH::SIZE_G8SWSH_3:
+            case SavSWSH::SIZE_G8SWSH_3A:
+            case SavSWSH::SIZE_G8SWSH_3B:
+            case SavSWSH::SIZE_G8SWSH_3C:
+                ret.emplace_back(candidate(SaveFormat::SWSH, CONFIDENCE_SIZE_ONLY));
+                break;
+            default:
+                break;
+        }
+
+        std::stable_sort(ret.begin(), ret.end(),
+            [](const SaveCandidate& a, const SaveCandidate& b)
+            { return a.confidence > b.confidence; });
+        return ret;
+    }
+}
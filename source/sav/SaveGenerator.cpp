@@ -0,0 +1,389 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+
+#include "sav/SaveGenerator.hpp"
+#include "pkx/PK8.hpp"
+#include "pkx/PKX.hpp"
+#include "sav/Sav1.hpp"
+#include "sav/Sav2.hpp"
+#include "sav/SavB2W2.hpp"
+#include "sav/SavBW.hpp"
+#include "sav/SavDP.hpp"
+#include "sav/SavE.hpp"
+#include "sav/SavFRLG.hpp"
+#include "sav/SavHGSS.hpp"
+#include "sav/SavLGPE.hpp"
+#include "sav/SavORAS.hpp"
+#include "sav/SavPT.hpp"
+#include "sav/SavRS.hpp"
+#include "sav/SavSUMO.hpp"
+#include "sav/SavSWSH.hpp"
+#include "sav/SavUSUM.hpp"
+#include "sav/SavXY.hpp"
+#include "utils/crypto.hpp"
+#include "utils/endian.hpp"
+#include "utils/random.hpp"
+#include "utils/utils.hpp"
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <span>
+
+namespace pksm
+{
+    namespace
+    {
+        // Gen 3 sector footers
+        constexpr size_t G3_BLOCK_COUNT = 14;
+        constexpr size_t G3_SIZE_BLOCK  = 0x1000;
+        constexpr u32 G3_SIGNATURE      = 0x08012025;
+        // Ruby/Sapphire store 0 where Emerald keeps its security key, and FireRed/LeafGreen 1
+        constexpr u32 G3_EMERALD_KEY = 0x4D534B50;
+
+        constexpr u32 DS_FOOTER_DATE = 0x20060623;
+
+        constexpr u32 BEEF = 0x42454546;
+
+        using SCBlockType = crypto::swsh::SCBlock::SCBlockType;
+        struct SWSHBlock
+        {
+            u32 key;
+            SCBlockType type;
+            u32 size;
+        };
+
+        // The blocks SavSWSH reads, in key order, each large enough for every field it touches
+        constexpr std::array<SWSHBlock, 13> SWSH_BLOCKS = {{
+            {0x017C3CBB, SCBlockType::Object, 32 * 4}, // current box; boxWallpaper reads it too
+            {0x0D66012C, SCBlockType::Object, 32 * 30 * PK8::PARTY_LENGTH},
+            {0x1177C2C4, SCBlockType::Object, 0x11F8 + 64 * 4},
+            {0x19722C89, SCBlockType::Object, 32 * 0x22},
+            {0x1B882B09, SCBlockType::Object, 0x218},
+            {0x2985FE5D, SCBlockType::Object, 6 * PK8::PARTY_LENGTH + 1},
+            {0x2EB1B190, SCBlockType::Object, 32 * 4},
+            {0x3C9366F0, SCBlockType::Object, 211 * 0x30},
+            {0x3F936BA9, SCBlockType::Object, 211 * 0x30},
+            {0x4716C404, SCBlockType::Object, 401 * 0x30},
+            {0x874DA6FA, SCBlockType::Object, 0xC8},
+            {0x8CBBFD90, SCBlockType::Object, 8},
+            {0xF25C070E, SCBlockType::Object, 0x110},
+        }};
+        // Takes up whatever the blocks above leave of the fixed save size
+        constexpr u32 SWSH_PADDING_KEY = 0xFFFFFFFF;
+
+        std::shared_ptr<u8[]> zeroed(size_t length)
+        {
+            std::shared_ptr<u8[]> ret(new u8[length]);
+            std::fill_n(ret.get(), length, 0);
+            return ret;
+        }
+
+        // Both halves get all fourteen sectors in order; the first half is the newer save
+        std::shared_ptr<u8[]> gen3Image(SaveFormat format)
+        {
+            std::shared_ptr<u8[]> data = zeroed(0x20000);
+            for (size_t half = 0; half < 2; half++)
+            {
+                u8* start = &data[half * G3_BLOCK_COUNT * G3_SIZE_BLOCK];
+                for (size_t i = 0; i < G3_BLOCK_COUNT; i++)
+                {
+                    u8* footer = start + i * G3_SIZE_BLOCK + 0xFF4;
+                    LittleEndian::convertFrom<u16>(footer, i);
+                    LittleEndian::convertFrom<u32>(footer + 4, G3_SIGNATURE);
+                    LittleEndian::convertFrom<u32>(footer + 8, 2 - half);
+                }
+
+                // International OT names are padded with terminators
+                std::fill_n(start, 8, 0xFF);
+                if (format == SaveFormat::FRLG)
+                {
+                    LittleEndian::convertFrom<u32>(start + 0xAC, 1);
+                }
+                else if (format == SaveFormat::E)
+                {
+                    LittleEndian::convertFrom<u32>(start + 0xAC, G3_EMERALD_KEY);
+                    // Battle tower data that Ruby/Sapphire leave zeroed
+                    start[0xEE1] = 0xFF;
+                    start[0xEE9] = 0xFF;
+                }
+            }
+            return data;
+        }
+
+        // Every DS block ends in a footer holding the block's size including the footer, a magic
+        // date, and the checksum that finishEditing fills in
+        void stampDSFooters(const Sav& save, u32 footerLength)
+        {
+            u8* data = save.rawData().get();
+            for (const Sav::BlockRange& block : save.blockMap())
+            {
+                u32 end = block.offset + block.length + footerLength;
+                LittleEndian::convertFrom<u32>(&data[end - 0xC], end - block.offset);
+                LittleEndian::convertFrom<u32>(&data[end - 0x8], DS_FOOTER_DATE);
+            }
+        }
+
+        // Gen 6+ describe their blocks in a table near the end of the save: 'BEEF', then a
+        // {u32 length, u16 id, u16 checksum} entry per block. finishEditing fills in the checksums.
+        void stampBlockInfo(const Sav& save, u32 infoOfs)
+        {
+            u8* info = save.rawData().get() + infoOfs;
+            LittleEndian::convertFrom<u32>(info, BEEF);
+            std::vector<Sav::BlockRange> blocks = save.blockMap();
+            for (size_t i = 0; i < blocks.size(); i++)
+            {
+                LittleEndian::convertFrom<u32>(info + 4 + i * 8, blocks[i].length);
+                LittleEndian::convertFrom<u16>(info + 8 + i * 8, i);
+            }
+        }
+
+        // Lays out the encrypted blocks, then xors and hashes the image like a real save
+        std::shared_ptr<u8[]> swshImage(size_t length)
+        {
+            std::shared_ptr<u8[]> data = zeroed(length);
+            std::span<u8> blocks{data.get(), length - 32};
+            size_t ofs = 0;
+            for (const SWSHBlock& block : SWSH_BLOCKS)
+            {
+                ofs += crypto::swsh::writeBlock(
+                    blocks.subspan(ofs), block.key, block.type, block.size);
+            }
+            // Object header: key, type and size
+            ofs += crypto::swsh::writeBlock(
+                blocks.subspan(ofs), SWSH_PADDING_KEY, SCBlockType::Object, length - 32 - ofs - 9);
+
+            crypto::swsh::applyXor(data, length);
+            crypto::swsh::sign(data, length);
+            return data;
+        }
+
+        std::unique_ptr<Sav> constructBlank(SaveFormat format)
+        {
+            switch (format)
+            {
+                case SaveFormat::RGBY:
+                    return std::make_unique<Sav1>(zeroed(0x8000), 0x8000);
+                case SaveFormat::GSC:
+                    return std::make_unique<Sav2>(zeroed(0x8000), 0x8000,
+                        std::tuple<GameVersion, Language, bool>{
+                            GameVersion::GD, Language::ENG, true});
+                case SaveFormat::RS:
+                    return std::make_unique<SavRS>(gen3Image(format));
+                case SaveFormat::E:
+                    return std::make_unique<SavE>(gen3Image(format));
+                case SaveFormat::FRLG:
+                    return std::make_unique<SavFRLG>(gen3Image(format));
+                case SaveFormat::DP:
+                {
+                    auto save = std::make_unique<SavDP>(zeroed(0x80000));
+                    stampDSFooters(*save, 0x14);
+                    return save;
+                }
+                case SaveFormat::Pt:
+                {
+                    auto save = std::make_unique<SavPT>(zeroed(0x80000));
+                    stampDSFooters(*save, 0x14);
+                    return save;
+                }
+                case SaveFormat::HGSS:
+                {
+                    auto save = std::make_unique<SavHGSS>(zeroed(0x80000));
+                    stampDSFooters(*save, 0x10);
+                    return save;
+                }
+                case SaveFormat::BW:
+                    return std::make_unique<SavBW>(zeroed(0x80000));
+                case SaveFormat::B2W2:
+                    return std::make_unique<SavB2W2>(zeroed(0x80000));
+                case SaveFormat::XY:
+                {
+                    auto save = std::make_unique<SavXY>(zeroed(0x65600));
+                    stampBlockInfo(*save, 0x65410);
+                    return save;
+                }
+                case SaveFormat::ORAS:
+                {
+                    auto save = std::make_unique<SavORAS>(zeroed(0x76000));
+                    stampBlockInfo(*save, 0x75E10);
+                    return save;
+                }
+                case SaveFormat::SM:
+                {
+                    auto save = std::make_unique<SavSUMO>(zeroed(0x6BE00));
+                    stampBlockInfo(*save, 0x6BC10);
+                    return save;
+                }
+                case SaveFormat::USUM:
+                {
+                    auto save = std::make_unique<SavUSUM>(zeroed(0x6CC00));
+                    stampBlockInfo(*save, 0x6CA10);
+                    return save;
+                }
+                case SaveFormat::LGPE:
+                {
+                    auto save = std::make_unique<SavLGPE>(zeroed(0x100000), 0x100000);
+                    stampBlockInfo(*save, 0xB8610);
+                    return save;
+                }
+                case SaveFormat::SWSH:
+                    return std::make_unique<SavSWSH>(
+                        swshImage(SavSWSH::SIZE_G8SWSH), SavSWSH::SIZE_G8SWSH);
+            }
+            return nullptr;
+        }
+
+        // The version stored in saves that keep one; the rest derive it from their layout
+        GameVersion blankVersion(SaveFormat format)
+        {
+            switch (format)
+            {
+                case SaveFormat::BW:
+                    return GameVersion::W;
+                case SaveFormat::B2W2:
+                    return GameVersion::W2;
+                case SaveFormat::XY:
+                    return GameVersion::X;
+                case SaveFormat::ORAS:
+                    return GameVersion::OR;
+                case SaveFormat::SM:
+                    return GameVersion::SN;
+                case SaveFormat::USUM:
+                    return GameVersion::US;
+                case SaveFormat::LGPE:
+                    return GameVersion::GP;
+                case SaveFormat::SWSH:
+                    return GameVersion::SW;
+                default:
+                    return GameVersion::INVALID;
+            }
+        }
+
+        template <typename T>
+        T pick(const std::set<T>& from)
+        {
+            return *std::next(from.begin(), randomNumber(0, from.size() - 1));
+        }
+    }
+
+    std::unique_ptr<Sav> blankSave(SaveFormat format)
+    {
+        std::unique_ptr<Sav> save = constructBlank(format);
+        if (GameVersion version = blankVersion(format); version != GameVersion::INVALID)
+        {
+            save->version(version);
+        }
+        save->language(Language::ENG);
+        save->otName("PKSM");
+        save->finishEditing();
+        return save;
+    }
+
+    std::unique_ptr<PKX> randomPkm(const Sav& save)
+    {
+        std::unique_ptr<PKX> pk = save.emptyPkm();
+        const Generation gen    = save.generation();
+        const Species species   = pick(save.availableSpecies());
+        const u8 level          = randomNumber(1, 100);
+
+        pk->TID(save.TID());
+        pk->SID(save.SID());
+        pk->otName(save.otName());
+        pk->otGender(save.gender());
+        pk->version(save.version());
+        pk->language(save.language());
+
+        pk->species(species);
+        pk->alternativeForm(0);
+        pk->level(level);
+        const std::string& name = species.localize(save.language());
+        pk->nickname(gen <= Generation::TWO ? StringUtils::toUpper(name) : name);
+        pk->nicknamed(false);
+
+        const u8 maxIv = gen <= Generation::TWO ? 15 : 31;
+        for (u8 stat = 0; stat < 6; stat++)
+        {
+            pk->iv(Stat(stat), randomNumber(0, maxIv));
+        }
+
+        // PKSM-Core has no learnsets, so these are any four distinct moves the game has
+        const std::set<Move>& moves = save.availableMoves();
+        std::array<Move, 4> chosen{};
+        for (u8 i = 0; i < 4; i++)
+        {
+            const auto previous = std::span{chosen}.first(i);
+            do
+            {
+                chosen[i] = pick(moves);
+            } while (
+                chosen[i] == Move::None || std::ranges::find(previous, chosen[i]) != previous.end());
+            pk->move(i, chosen[i]);
+        }
+        pk->healPP();
+        pk->currentFriendship(pk->baseFriendship());
+
+        if (gen >= Generation::THREE)
+        {
+            // Gen 3 and 4 setters reroll the PID to keep it consistent, so this only pins down
+            // the other fields; the final PID is drawn once all of them are known
+            pk->setAbility(randomNumber(0, 1));
+            pk->gender(PKX::genderFromRatio(randomNumber(0, 0xFFFFFFFF), pk->genderType()));
+            pk->nature(Nature{u8(randomNumber(0, 24))});
+            pk->PID(PKX::getRandomPID(species, pk->gender(), pk->version(), pk->nature(), 0,
+                pk->abilityNumber(), false, pk->TSV(), pk->PID(), gen));
+            pk->ball(Ball::Poke);
+            pk->metLevel(level);
+        }
+        if (gen >= Generation::SIX)
+        {
+            pk->encryptionConstant(randomNumber(0, 0xFFFFFFFF));
+        }
+
+        pk->refreshChecksum();
+        return pk;
+    }
+
+    std::unique_ptr<Sav> generateSave(SaveFormat format, u32 seed, int count)
+    {
+        std::unique_ptr<Sav> save = blankSave(format);
+        seedRand(seed);
+
+        save->beginEditing();
+        save->TID(randomNumber(0, 0xFFFF));
+        save->SID(randomNumber(0, 0xFFFF));
+        save->gender(randomNumber(0, 1) ? Gender::Female : Gender::Male);
+
+        const int slots  = std::min(count, save->maxSlot());
+        const int perBox = (save->maxSlot() + save->maxBoxes() - 1) / save->maxBoxes();
+        for (int i = 0; i < slots; i++)
+        {
+            save->pkm(*randomPkm(*save), i / perBox, i % perBox, false);
+        }
+
+        save->finishEditing();
+        return save;
+    }
+}
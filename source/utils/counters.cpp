@@ -0,0 +1,159 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+
+#include "utils/counters.hpp"
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace pksm::counters
+{
+#ifdef _PKSMCORE_ENABLE_COUNTERS
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+    constinit Snapshot internal::current;
+#else
+    constinit thread_local Snapshot internal::current;
+    constinit thread_local bool internal::registered = false;
+
+    namespace
+    {
+        struct Registry
+        {
+            std::mutex mutex;
+            std::vector<Snapshot*> live;
+            // What threads that have exited counted
+            Snapshot retired;
+        };
+
+        Registry& registry()
+        {
+            static Registry ret;
+            return ret;
+        }
+
+        void accumulate(Snapshot& into, Snapshot& from)
+        {
+            for (size_t i = 0; i < size_t(Counter::COUNT); i++)
+            {
+                into.counts[i] += std::atomic_ref(from.counts[i]).load(std::memory_order_relaxed);
+                into.nanoseconds[i] +=
+                    std::atomic_ref(from.nanoseconds[i]).load(std::memory_order_relaxed);
+            }
+        }
+
+        // Folds a thread's counters into the retired totals when it exits
+        struct Registration
+        {
+            Registration()
+            {
+                std::lock_guard lock(registry().mutex);
+                registry().live.push_back(&internal::current);
+            }
+            ~Registration()
+            {
+                std::lock_guard lock(registry().mutex);
+                accumulate(registry().retired, internal::current);
+                std::erase(registry().live, &internal::current);
+            }
+        };
+    }
+
+    void internal::registerThread()
+    {
+        static thread_local Registration registration;
+        registered = true;
+    }
+#endif
+#endif
+
+    const char* name(Counter counter)
+    {
+        switch (counter)
+        {
+            case Counter::SCBlockDecrypts:
+                return "SCBlock decrypts";
+            case Counter::PKXAllocations:
+                return "PKX allocations";
+            case Counter::PKXClones:
+                return "PKX clones";
+            case Counter::CryptBytes:
+                return "crypt bytes";
+            case Counter::ChecksumBytes:
+                return "checksum bytes";
+            case Counter::I18nLookups:
+                return "i18n lookups";
+            case Counter::I18nMisses:
+                return "i18n misses";
+            case Counter::RandomPIDIterations:
+                return "getRandomPID iterations";
+            case Counter::COUNT:
+                break;
+        }
+        return "";
+    }
+
+    Snapshot snapshot()
+    {
+#ifdef _PKSMCORE_ENABLE_COUNTERS
+        return internal::current;
+#else
+        return {};
+#endif
+    }
+
+    void reset()
+    {
+#ifdef _PKSMCORE_ENABLE_COUNTERS
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        internal::current = {};
+#else
+        for (size_t i = 0; i < size_t(Counter::COUNT); i++)
+        {
+            std::atomic_ref(internal::current.counts[i]).store(0, std::memory_order_relaxed);
+            std::atomic_ref(internal::current.nanoseconds[i]).store(0, std::memory_order_relaxed);
+        }
+#endif
+#endif
+    }
+
+    Snapshot snapshotAll()
+    {
+#if !defined(_PKSMCORE_ENABLE_COUNTERS)
+        return {};
+#elif defined(_PKSMCORE_DISABLE_THREAD_SAFETY)
+        return internal::current;
+#else
+        std::lock_guard lock(registry().mutex);
+        Snapshot ret = registry().retired;
+        for (Snapshot* thread : registry().live)
+        {
+            accumulate(ret, *thread);
+        }
+        return ret;
+#endif
+    }
+}
@@ -69,6 +69,7 @@ namespace pksm::crypto
 
     u16 ccitt16(std::span<const u8> buf)
     {
+        counters::Timed timed(counters::Counter::ChecksumBytes, buf.size());
         u16 crc = 0xFFFF;
         for (u32 i = 0; i < buf.size(); i++)
         {
@@ -86,15 +87,18 @@ namespace pksm::crypto
 
     u16 crc16(std::span<const u8> buf)
     {
+        counters::Timed timed(counters::Counter::ChecksumBytes, buf.size());
         return ~internal::crc16(buf, 0xFFFF);
     }
     u16 crc16_noinvert(std::span<const u8> buf)
     {
+        counters::Timed timed(counters::Counter::ChecksumBytes, buf.size());
         return internal::crc16(buf, 0);
     }
 
     u8 diff8(std::span<const u8> buf)
     {
+        counters::Timed timed(counters::Counter::ChecksumBytes, buf.size());
         u8 val = 255;
         for (size_t i = 0; i < buf.size(); i++)
             val -= buf[i];
@@ -103,6 +107,7 @@ namespace pksm::crypto
 
     u16 bytewiseSum16(std::span<const u8> buf)
     {
+        counters::Timed timed(counters::Counter::ChecksumBytes, buf.size());
         u16 val = 0;
         for (size_t i = 0; i < buf.size(); i++)
         {
@@ -113,6 +118,7 @@ namespace pksm::crypto
 
     u32 sum32(std::span<const u8> buf)
     {
+        counters::Timed timed(counters::Counter::ChecksumBytes, buf.size());
         u32 val = 0;
         for (size_t i = 0; i < buf.size(); i += 4)
             val += LittleEndian::convertTo<u32>(buf.data() + i);
@@ -124,6 +124,7 @@ namespace pksm::crypto
 
     void SHA256::update(std::span<const u8> buf)
     {
+        counters::Timed timed(counters::Counter::ChecksumBytes, buf.size());
         for (size_t i = 0; i < buf.size(); i++)
         {
             data[dataLength++] = buf[i];
@@ -26,6 +26,8 @@
 
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
+#include <algorithm>
+#include <atomic>
 #include <bit>
 
 namespace pksm::crypto::swsh
@@ -162,63 +164,106 @@ namespace pksm::crypto::swsh
         return true;
     }
 
-    std::vector<std::shared_ptr<SCBlock>> getBlockList(std::shared_ptr<u8[]> data, size_t length)
+    std::vector<SCBlock> getBlockList(std::span<u8> data, bool decrypt)
     {
-        std::vector<std::shared_ptr<SCBlock>> ret;
-        size_t offset = 0;
-        while (offset < length - 32)
+        std::vector<SCBlock> ret;
+        for (const SCBlockDescriptor& descriptor : blocks(data))
         {
-            ret.emplace_back(new SCBlock(data, offset));
+            ret.emplace_back(SCBlock{descriptor, decrypt});
         }
 
         return ret;
     }
 
-    SCBlock::SCBlock(std::shared_ptr<u8[]> data, size_t& offset) : data(data), myOffset(offset)
+    size_t writeBlock(std::span<u8> out, u32 key, SCBlock::SCBlockType type, u32 dataSize)
     {
-        // Key size
-        offset += 4;
+        if (type == SCBlock::SCBlockType::Array)
+        {
+            return 0;
+        }
+        if (type != SCBlock::SCBlockType::Object)
+        {
+            dataSize = type == SCBlock::SCBlockType::Bool1 ||
+                               type == SCBlock::SCBlockType::Bool2 ||
+                               type == SCBlock::SCBlockType::Bool3
+                           ? 0
+                           : SCBlock::arrayEntrySize(type);
+        }
+        size_t header = SCBlock::headerSize(type);
+        if (out.size() < header + dataSize)
+        {
+            return 0;
+        }
 
-        internal::XorShift32 xorShift(key());
+        std::fill_n(out.begin(), header + dataSize, 0);
+        LittleEndian::convertFrom<u32>(out.data(), key);
+        out[4] = u8(type);
+        if (type == SCBlock::SCBlockType::Object)
+        {
+            LittleEndian::convertFrom<u32>(out.data() + 5, dataSize);
+        }
 
-        type = SCBlockType(data[offset] ^= xorShift.next());
+        internal::XorShift32 xorShift(key);
+        for (size_t i = 4; i < header + dataSize; i++)
+        {
+            out[i] ^= xorShift.next();
+        }
+        return header + dataSize;
+    }
 
-        switch (type)
+    SCBlockIterator::SCBlockIterator(u8* data, size_t offset, size_t end)
+        : data(data), offset(offset), end(end)
+    {
+        read();
+    }
+
+    SCBlockIterator& SCBlockIterator::operator++()
+    {
+        offset = nextOfs;
+        read();
+        return *this;
+    }
+
+    void SCBlockIterator::read()
+    {
+        if (offset < end)
+        {
+            current = SCBlock::readHeader(data + offset);
+            nextOfs = current.data.data() + current.data.size() - data;
+            if (nextOfs > end)
+            {
+                throw internal::CryptoException(
+                    "Decoding block: Key: " + std::to_string(current.key) + "\nOverruns save");
+            }
+        }
+    }
+
+    SCBlockDescriptor SCBlock::readHeader(u8* block)
+    {
+        SCBlockDescriptor ret;
+        ret.key = LittleEndian::convertTo<u32>(block);
+        internal::XorShift32 xorShift(ret.key);
+
+        ret.type     = SCBlockType(block[4] ^ xorShift.next());
+        ret.subtype  = SCBlockType::None;
+        u32 dataSize = 0;
+
+        switch (ret.type)
         {
             case SCBlockType::Bool1:
             case SCBlockType::Bool2:
             case SCBlockType::Bool3:
                 // No extra data
-                offset++;
                 break;
             case SCBlockType::Object:
-            {
-                dataLength =
-                    LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
-                LittleEndian::convertFrom<u32>(data.get() + offset + 1, dataLength);
-                for (size_t i = 0; i < dataLength; i++)
-                {
-                    data[offset + 5 + i] ^= xorShift.next();
-                }
-                offset += 5 + dataLength;
-            }
-            break;
+                dataSize = LittleEndian::convertTo<u32>(block + 5) ^ xorShift.next32();
+                break;
             case SCBlockType::Array:
-            {
-                dataLength =
-                    LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
-                LittleEndian::convertFrom<u32>(data.get() + offset + 1, dataLength);
-                subtype = SCBlockType(data[offset + 5] ^= xorShift.next());
-                switch (subtype)
+                dataSize    = LittleEndian::convertTo<u32>(block + 5) ^ xorShift.next32();
+                ret.subtype = SCBlockType(block[9] ^ xorShift.next());
+                switch (ret.subtype)
                 {
                     case SCBlockType::Bool3:
-                        // An array of booleans
-                        for (size_t i = 0; i < dataLength; i++)
-                        {
-                            data[offset + 6 + i] ^= xorShift.next();
-                        }
-                        offset += 6 + dataLength;
-                        break;
                     case SCBlockType::U8:
                     case SCBlockType::U16:
                     case SCBlockType::U32:
@@ -229,22 +274,14 @@ namespace pksm::crypto::swsh
                     case SCBlockType::S64:
                     case SCBlockType::Float:
                     case SCBlockType::Double:
-                    {
-                        size_t entrySize = arrayEntrySize(subtype);
-                        for (size_t i = 0; i < dataLength * entrySize; i++)
-                        {
-                            data[offset + 6 + i] ^= xorShift.next();
-                        }
-                        offset += 6 + (dataLength * entrySize);
-                    }
-                    break;
+                        dataSize *= arrayEntrySize(ret.subtype);
+                        break;
                     default:
                         throw internal::CryptoException(
-                            "Decoding block: Key: " + std::to_string(key()) +
-                            "\nSubtype: " + std::to_string(u8(type)));
+                            "Decoding block: Key: " + std::to_string(ret.key) +
+                            "\nSubtype: " + std::to_string(u8(ret.subtype)));
                 }
-            }
-            break;
+                break;
             case SCBlockType::U8:
             case SCBlockType::U16:
             case SCBlockType::U32:
@@ -255,56 +292,137 @@ namespace pksm::crypto::swsh
             case SCBlockType::S64:
             case SCBlockType::Float:
             case SCBlockType::Double:
-            {
-                size_t entrySize = arrayEntrySize(type);
-                for (size_t i = 0; i < entrySize; i++)
-                {
-                    data[offset + 1 + i] ^= xorShift.next();
-                }
-                offset += 1 + entrySize;
-            }
-            break;
+                dataSize = arrayEntrySize(ret.type);
+                break;
             default:
-                throw internal::CryptoException("Decoding block: Key: " + std::to_string(key()) +
-                                                "\nType: " + std::to_string(u8(type)));
+                throw internal::CryptoException("Decoding block: Key: " + std::to_string(ret.key) +
+                                                "\nType: " + std::to_string(u8(ret.type)));
         }
+
+        ret.data = std::span{block + headerSize(ret.type), dataSize};
+        return ret;
     }
 
-    void SCBlock::encrypt()
+    SCBlock::SCBlock(const SCBlockDescriptor& descriptor, bool decryptNow)
+        : block(descriptor.data.data() - headerSize(descriptor.type)),
+          dataSize(descriptor.data.size()),
+          type(descriptor.type),
+          subtype(descriptor.subtype)
     {
-        if (!currentlyEncrypted)
+        if (decryptNow)
         {
-            internal::XorShift32 xorShift(key());
-            for (size_t i = 0; i < encryptedDataSize() - 4; i++)
-            {
-                data[myOffset + 4 + i] ^= xorShift.next();
-            }
+            decrypt();
+        }
+    }
+
+    SCBlock::CryptState SCBlock::loadState(void) const
+    {
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        return state;
+#else
+        return std::atomic_ref(const_cast<CryptState&>(state)).load(std::memory_order_acquire);
+#endif
+    }
 
-            currentlyEncrypted = true;
+    void SCBlock::storeState(CryptState v)
+    {
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        state = v;
+#else
+        std::atomic_ref(state).store(v, std::memory_order_release);
+#endif
+    }
+
+    void SCBlock::applyKeystream(void)
+    {
+        internal::XorShift32 xorShift(key());
+        for (size_t i = 0; i < encryptedDataSize() - 4; i++)
+        {
+            block[4 + i] ^= xorShift.next();
+        }
+    }
+
+    void SCBlock::encrypt()
+    {
+        if (loadState() == CryptState::Decrypted)
+        {
+            applyKeystream();
+            storeState(CryptState::Encrypted);
         }
     }
 
     void SCBlock::decrypt()
     {
-        if (currentlyEncrypted)
+        if (loadState() == CryptState::Decrypted)
+        {
+            return;
+        }
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        counters::Timed timed(counters::Counter::SCBlockDecrypts);
+        applyKeystream();
+        state = CryptState::Decrypted;
+#else
+        // Const getters of a shared save decrypt lazily, so several readers may get here at once.
+        // One of them claims the block and the rest wait for it to finish
+        std::atomic_ref current(state);
+        CryptState expected = CryptState::Encrypted;
+        if (current.compare_exchange_strong(expected, CryptState::Decrypting,
+                std::memory_order_acquire, std::memory_order_acquire))
         {
-            internal::XorShift32 xorShift(key());
-            for (size_t i = 0; i < encryptedDataSize() - 4; i++)
             {
-                data[myOffset + 4 + i] ^= xorShift.next();
+                counters::Timed timed(counters::Counter::SCBlockDecrypts);
+                applyKeystream();
             }
+            current.store(CryptState::Decrypted, std::memory_order_release);
+            current.notify_all();
+        }
+        else
+        {
+            while (expected == CryptState::Decrypting)
+            {
+                current.wait(CryptState::Decrypting, std::memory_order_acquire);
+                expected = current.load(std::memory_order_acquire);
+            }
+        }
+#endif
+    }
 
-            currentlyEncrypted = false;
+    void SCBlock::blockType(SCBlockType v)
+    {
+        auto isBool = [](SCBlockType t) {
+            return t == SCBlockType::Bool1 || t == SCBlockType::Bool2;
+        };
+        if (v != type && isBool(type) && isBool(v))
+        {
+            decrypt();
+            block[4] = u8(v);
+            type     = v;
+        }
+    }
+
+    bool SCBlock::sameContents(SCBlock& other)
+    {
+        if (type != other.type || dataSize != other.dataSize)
+        {
+            return false;
+        }
+        // Only two encrypted blocks can be compared as they are; a block another thread is
+        // decrypting is waited for
+        if (loadState() != CryptState::Encrypted || other.loadState() != CryptState::Encrypted)
+        {
+            decrypt();
+            other.decrypt();
         }
+        return std::equal(block, block + encryptedDataSize(), other.block);
     }
 
     u32 SCBlock::key() const
     {
-        return LittleEndian::convertTo<u32>(&data[myOffset]);
+        return LittleEndian::convertTo<u32>(block);
     }
     void SCBlock::key(u32 v)
     {
-        LittleEndian::convertFrom<u32>(&data[myOffset], v);
+        LittleEndian::convertFrom<u32>(block, v);
     }
 
     size_t SCBlock::arrayEntrySize(SCBlockType type)
@@ -357,35 +475,4 @@ namespace pksm::crypto::swsh
                 throw internal::CryptoException("Type size unknown: " + std::to_string(u32(type)));
         }
     }
-
-    size_t SCBlock::encryptedDataSize()
-    {
-        static constexpr int baseSize = 4 + 1; // key + type
-        switch (type)
-        {
-            case SCBlockType::Bool1:
-            case SCBlockType::Bool2:
-            case SCBlockType::Bool3:
-                return baseSize;
-            case SCBlockType::Object:
-                return baseSize + 4 + dataLength; // + datalength variable + actual data
-            case SCBlockType::Array:
-                return baseSize + 5 +
-                       dataLength *
-                           arrayEntrySize(subtype); // + subtype + datalength variable + actual data
-            case SCBlockType::U8:
-            case SCBlockType::U16:
-            case SCBlockType::U32:
-            case SCBlockType::U64:
-            case SCBlockType::S8:
-            case SCBlockType::S16:
-            case SCBlockType::S32:
-            case SCBlockType::S64:
-            case SCBlockType::Float:
-            case SCBlockType::Double:
-                return baseSize + arrayEntrySize(type); // + actual data
-            default:
-                throw internal::CryptoException("Type size unknown: " + std::to_string(u32(type)));
-        }
-    }
 }
@@ -25,11 +25,62 @@
  */
 
 #include "utils/io.hpp"
+#include <fcntl.h>
+#include <stdio.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#define PKSMCORE_HAS_MMAP
+#endif
 
 bool io::exists(const std::string& name)
 {
     struct stat buffer;
     return (stat(name.c_str(), &buffer) == 0);
 }
+
+std::pair<std::shared_ptr<u8[]>, size_t> io::mapFile(const std::string& name, bool writable)
+{
+    int fd = open(name.c_str(), writable ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+    {
+        return {nullptr, 0};
+    }
+
+    struct stat buffer;
+    if (fstat(fd, &buffer) != 0 || buffer.st_size <= 0)
+    {
+        close(fd);
+        return {nullptr, 0};
+    }
+    size_t length = buffer.st_size;
+
+#ifdef PKSMCORE_HAS_MMAP
+    void* mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+        writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return {nullptr, 0};
+    }
+    return {std::shared_ptr<u8[]>((u8*)mapped, [length](u8* p) { munmap(p, length); }), length};
+#else
+    // No way to write through; writable callers must save rawData() themselves
+    std::shared_ptr<u8[]> ret = std::shared_ptr<u8[]>(new u8[length]);
+    size_t done               = 0;
+    while (done < length)
+    {
+        ssize_t got = read(fd, ret.get() + done, length - done);
+        if (got <= 0)
+        {
+            close(fd);
+            return {nullptr, 0};
+        }
+        done += got;
+    }
+    close(fd);
+    return {ret, length};
+#endif
+}
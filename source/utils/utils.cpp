@@ -32,6 +32,7 @@
 #include "utils/endian.hpp"
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <map>
 #include <queue>
 #include <vector>
@@ -333,6 +334,116 @@ namespace
         return codepoint;
     }
 
+    // Length of the run of ASCII characters at the start of src. Checks a word at a time; the
+    // strings this handles are short and the targets vary too much for vector intrinsics to pay.
+    size_t asciiPrefix(const char* src, size_t size)
+    {
+        size_t i = 0;
+        for (; i + sizeof(u64) <= size; i += sizeof(u64))
+        {
+            u64 word;
+            std::memcpy(&word, src + i, sizeof(u64));
+            if (word & 0x8080'8080'8080'8080)
+            {
+                break;
+            }
+        }
+        while (i < size && !(src[i] & 0x80))
+        {
+            i++;
+        }
+        return i;
+    }
+
+    size_t asciiPrefix(const char16_t* src, size_t size)
+    {
+        size_t i = 0;
+        for (; i + sizeof(u64) / sizeof(char16_t) <= size; i += sizeof(u64) / sizeof(char16_t))
+        {
+            u64 word;
+            std::memcpy(&word, src + i, sizeof(u64));
+            if (word & 0xFF80'FF80'FF80'FF80)
+            {
+                break;
+            }
+        }
+        while (i < size && src[i] < 0x80)
+        {
+            i++;
+        }
+        return i;
+    }
+
+    size_t asciiPrefix(const char32_t* src, size_t size)
+    {
+        size_t i = 0;
+        while (i < size && src[i] < 0x80)
+        {
+            i++;
+        }
+        return i;
+    }
+
+    // Copies the ASCII run at src[i] straight into ret, widening or narrowing as needed. Returns
+    // whether there is anything left that needs decoding.
+    template <typename Out, typename In>
+    bool appendASCII(Out& ret, const In& src, size_t& i)
+    {
+        size_t ascii = asciiPrefix(src.data() + i, src.size() - i);
+        ret.append(src.begin() + i, src.begin() + i + ascii);
+        i += ascii;
+        return i < src.size();
+    }
+
+    // What transStringXX does to a single UCS-2 code unit, including its UTF-16 round trip turning
+    // unpaired surrogates into U+FFFD. Without a swap, code units are passed through untouched
+    // like the plain getString does.
+    char16_t swapCodeUnit(char16_t unit, StringUtils::CharSwap swap)
+    {
+        if (swap == StringUtils::CharSwap::None)
+        {
+            return unit;
+        }
+        if (unit >= 0xD800 && unit <= 0xDFFF)
+        {
+            return StringUtils::CODEPOINT_INVALID;
+        }
+        return swap == StringUtils::CharSwap::Gen45 ? swapCodepoints45(unit)
+                                                    : swapCodepoints67(unit);
+    }
+
+    // Reads the next codepoint of v as the swapped UCS-2 code unit a setter should store
+    char16_t nextSwappedUnit(const std::string_view& v, size_t& i, StringUtils::CharSwap swap)
+    {
+        // ASCII is never swapped
+        if (!(v[i] & 0x80))
+        {
+            return v[i++];
+        }
+        auto [codepoint, size] = StringUtils::UTF8toCodepoint(v.data() + i, v.size() - i);
+        i += size;
+        // Surrogates and anything outside the BMP can't be stored
+        return swapCodeUnit(StringUtils::codepointToUCS2(codepoint), swap);
+    }
+
+    // Appends a codepoint if it fits, returning false if it did not
+    bool appendUTF8(std::span<char> out, size_t& outSize, char32_t codepoint)
+    {
+        if (codepoint < 0x80 && outSize < out.size())
+        {
+            out[outSize++] = codepoint;
+            return true;
+        }
+        auto [data, size] = StringUtils::codepointToUTF8(codepoint);
+        if (outSize + size > out.size())
+        {
+            return false;
+        }
+        std::copy_n(data.data(), size, out.data() + outSize);
+        outSize += size;
+        return true;
+    }
+
     // Converts a single latin character from half-width to full-width
     char16_t tofullwidth(char16_t c)
     {
@@ -349,7 +460,7 @@ std::u16string StringUtils::UTF8toUTF16(const std::string_view& src)
     std::u16string ret;
     ret.reserve(src.size());
     size_t i = 0;
-    while (i < src.size())
+    while (appendASCII(ret, src, i))
     {
         auto [codepoint, advance] = UTF8toCodepoint(src.data() + i, src.size() - i);
         auto [data, newSize]      = codepointToUTF16(codepoint);
@@ -365,7 +476,7 @@ std::u16string StringUtils::UTF8toUCS2(const std::string_view& src)
     std::u16string ret;
     ret.reserve(src.size());
     size_t i = 0;
-    while (i < src.size())
+    while (appendASCII(ret, src, i))
     {
         auto [codepoint, advance] = UTF8toCodepoint(src.data() + i, src.size() - i);
         ret.push_back(codepointToUCS2(codepoint));
@@ -379,7 +490,7 @@ std::u32string StringUtils::UTF8toUTF32(const std::string_view& src)
     std::u32string ret;
     ret.reserve(src.size());
     size_t i = 0;
-    while (i < src.size())
+    while (appendASCII(ret, src, i))
     {
         auto [codepoint, advance] = UTF8toCodepoint(src.data() + i, src.size() - i);
         ret.push_back(codepoint);
@@ -393,7 +504,7 @@ std::string StringUtils::UTF16toUTF8(const std::u16string_view& src)
     std::string ret;
     ret.reserve(src.size()); // Size must be greater than or equal to this
     size_t i = 0;
-    while (i < src.size())
+    while (appendASCII(ret, src, i))
     {
         auto [codepoint, advance] = UTF16toCodepoint(src.data() + i, src.size() - i);
         auto [data, newSize]      = codepointToUTF8(codepoint);
@@ -408,7 +519,7 @@ std::u16string StringUtils::UTF16toUCS2(const std::u16string_view& src)
     std::u16string ret;
     ret.reserve(src.size());
     size_t i = 0;
-    while (i < src.size())
+    while (appendASCII(ret, src, i))
     {
         auto [codepoint, advance] = UTF16toCodepoint(src.data() + i, src.size() - i);
         ret.push_back(codepointToUCS2(codepoint));
@@ -422,7 +533,7 @@ std::u32string StringUtils::UTF16toUTF32(const std::u16string_view& src)
     std::u32string ret;
     ret.reserve(src.size());
     size_t i = 0;
-    while (i < src.size())
+    while (appendASCII(ret, src, i))
     {
         auto [codepoint, advance] = UTF16toCodepoint(src.data() + i, src.size() - i);
         ret.push_back(codepoint);
@@ -435,9 +546,10 @@ std::string StringUtils::UTF32toUTF8(const std::u32string_view& src)
 {
     std::string ret;
     ret.reserve(src.size()); // Length *must* be greater than or equal to this.
-    for (const char32_t codepoint : src)
+    size_t i = 0;
+    while (appendASCII(ret, src, i))
     {
-        auto [data, size] = codepointToUTF8(codepoint);
+        auto [data, size] = codepointToUTF8(src[i++]);
         ret.append(data.data(), size);
     }
     return ret;
@@ -447,9 +559,10 @@ std::u16string StringUtils::UTF32toUTF16(const std::u32string_view& src)
 {
     std::u16string ret;
     ret.reserve(src.size());
-    for (char32_t codepoint : src)
+    size_t i = 0;
+    while (appendASCII(ret, src, i))
     {
-        auto [data, size] = codepointToUTF16(codepoint);
+        auto [data, size] = codepointToUTF16(src[i++]);
         ret.append(data.data(), size);
     }
     return ret;
@@ -458,9 +571,11 @@ std::u16string StringUtils::UTF32toUTF16(const std::u32string_view& src)
 std::u16string StringUtils::UTF32toUCS2(const std::u32string_view& src)
 {
     std::u16string ret;
-    for (const char32_t& codepoint : src)
+    ret.reserve(src.size());
+    size_t i = 0;
+    while (appendASCII(ret, src, i))
     {
-        ret.push_back(codepointToUCS2(codepoint));
+        ret.push_back(codepointToUCS2(src[i++]));
     }
     return ret;
 }
@@ -685,6 +800,113 @@ void StringUtils::setString(
     }
 }
 
+size_t StringUtils::getString(
+    std::span<char> out, const u8* data, int ofs, int len, char16_t term, CharSwap swap)
+{
+    size_t outSize = 0;
+    for (int i = 0; i < len; i++)
+    {
+        char16_t codeunit = LittleEndian::convertTo<char16_t>(data + ofs + i * 2);
+        if (codeunit == term)
+        {
+            break;
+        }
+        if (!appendUTF8(out, outSize, codeunit < 0x80 ? codeunit : swapCodeUnit(codeunit, swap)))
+        {
+            break;
+        }
+    }
+    return outSize;
+}
+
+std::string StringUtils::getString(const u8* data, int ofs, int len, char16_t term, CharSwap swap)
+{
+    // Every UCS-2 code unit is at most 3 UTF-8 bytes
+    std::array<char, 3 * 24> buffer;
+    if (size_t(len) * 3 <= buffer.size())
+    {
+        return std::string(buffer.data(), getString(buffer, data, ofs, len, term, swap));
+    }
+    std::string ret(size_t(len) * 3, '\0');
+    ret.resize(getString(ret, data, ofs, len, term, swap));
+    return ret;
+}
+
+void StringUtils::setString(u8* data, const std::string_view& v, int ofs, int len,
+    char16_t terminator, char16_t padding, CharSwap swap)
+{
+    int outOfs = 0;
+    size_t i   = 0;
+    while (i < v.size() && outOfs < len - 1)
+    {
+        LittleEndian::convertFrom<char16_t>(data + ofs + outOfs++ * 2, nextSwappedUnit(v, i, swap));
+    }
+    LittleEndian::convertFrom<char16_t>(data + ofs + (outOfs++ * 2), terminator); // Set terminator
+    for (; outOfs < len; outOfs++)
+    {
+        LittleEndian::convertFrom<char16_t>(data + ofs + (outOfs * 2),
+            padding); // Set final padding bytes
+    }
+}
+
+size_t StringUtils::getString4(
+    std::span<char> out, const u8* data, int ofs, int len, CharSwap swap)
+{
+    size_t outSize = 0;
+    for (int i = 0; i < len; i++)
+    {
+        u16 temp = LittleEndian::convertTo<u16>(data + ofs + i * 2);
+        if (temp == 0xFFFF)
+            break;
+        auto found =
+            std::find(pksm::internal::G4Values.begin(), pksm::internal::G4Values.end(), temp);
+        // Treat an invalid value as a terminator
+        if (found == pksm::internal::G4Values.end())
+        {
+            break;
+        }
+        u16 codepoint =
+            pksm::internal::G4Chars[std::distance(pksm::internal::G4Values.begin(), found)];
+        if (codepoint == 0xFFFF)
+            break;
+        if (!appendUTF8(out, outSize, swapCodeUnit(codepoint, swap)))
+        {
+            break;
+        }
+    }
+    return outSize;
+}
+
+std::string StringUtils::getString4(const u8* data, int ofs, int len, CharSwap swap)
+{
+    std::array<char, 3 * 24> buffer;
+    if (size_t(len) * 3 <= buffer.size())
+    {
+        return std::string(buffer.data(), getString4(buffer, data, ofs, len, swap));
+    }
+    std::string ret(size_t(len) * 3, '\0');
+    ret.resize(getString4(ret, data, ofs, len, swap));
+    return ret;
+}
+
+void StringUtils::setString4(u8* data, const std::string_view& v, int ofs, int len, CharSwap swap)
+{
+    int outIndex = 0;
+    size_t i     = 0;
+    while (outIndex < len - 1 && i < v.size())
+    {
+        char16_t codepoint = nextSwappedUnit(v, i, swap);
+
+        auto found =
+            std::find(pksm::internal::G4Chars.begin(), pksm::internal::G4Chars.end(), codepoint);
+        LittleEndian::convertFrom<u16>(data + ofs + outIndex++ * 2,
+            found != pksm::internal::G4Chars.end()
+                ? pksm::internal::G4Values[std::distance(pksm::internal::G4Chars.begin(), found)]
+                : 0x0000);
+    }
+    LittleEndian::convertFrom<u16>(data + ofs + outIndex * 2, 0xFFFF);
+}
+
 std::string StringUtils::getString4(const u8* data, int ofs, int len)
 {
     std::string output;
@@ -95,7 +95,7 @@ namespace pksm
 
     std::string PGF::title(void) const
     {
-        return StringUtils::transString45(StringUtils::getString(data, 0x60, 37, u'\uFFFF'));
+        return StringUtils::getString(data, 0x60, 37, u'\uFFFF', StringUtils::CharSwap::Gen45);
     }
 
     u8 PGF::type(void) const